@@ -21,6 +21,7 @@ class IDestination;
 class IAction;
 class Bencode_Impl;
 struct Node;
+struct ArenaOptions;
 
 class Bencode {
 
@@ -45,6 +46,10 @@ public:
   // Constructors/Destructors
   explicit Bencode([[maybe_unused]] IStringify *stringify = nullptr,
                    [[maybe_unused]] IParser *parser = nullptr);
+  // Document whose Node tree memory comes from its own arena
+  explicit Bencode(const ArenaOptions &arena,
+                   [[maybe_unused]] IStringify *stringify = nullptr,
+                   [[maybe_unused]] IParser *parser = nullptr);
   // Pass in default JSON to parse
   explicit Bencode(const std::string_view &bencodeString);
   // Construct an array
@@ -62,6 +67,9 @@ public:
   // Parse Bencode into Node tree
   ParseResultType parse(ISource &source) const;
   ParseResultType parse(ISource &&source) const;
+  // Check Bencode is well formed without building a Node tree
+  [[nodiscard]] static ParseStatus validate(ISource &source);
+  [[nodiscard]] static ParseStatus validate(ISource &&source);
   // Stringify Bencode from Node tree
   void stringify(IDestination &destination) const;
   void stringify(IDestination &&destination) const;
@@ -73,6 +81,8 @@ public:
   // Traverse Bencode tree
   [[maybe_unused]] void traverse(IAction &action);
   void traverse(IAction &action) const;
+  // Copy strings and keys borrowed from the parse source into the tree
+  void promote();
   // Search for Bencode dictionary entry with a given key
   Node &operator[](const std::string_view &key);
   const Node &operator[](const std::string_view &key) const;
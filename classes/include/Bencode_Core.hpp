@@ -23,7 +23,15 @@
 #include "Bencode_Destinations.hpp"
 #include "Bencode_Error.hpp"
 #include "Bencode_Status.hpp"
+#include "Bencode_Integer_Format.hpp"
 #include "Default_Translator.hpp"
 #include "Default_Parser.hpp"
+#include "Indexed_Parser.hpp"
+#include "Path_Extractor.hpp"
+#include "Validator.hpp"
+#include "Event_Parser.hpp"
+#include "Push_Parser.hpp"
+#include "Batch_Parser.hpp"
+#include "Bencode_Tape.hpp"
 #include "Default_Stringify.hpp"
 #include "Bencode_Optional_Stringify.hpp"
\ No newline at end of file
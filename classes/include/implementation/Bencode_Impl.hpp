@@ -17,7 +17,8 @@ class Bencode_Impl {
 
 public:
   // Constructors/Destructors
-  Bencode_Impl(IStringify *stringify, IParser *parser);
+  Bencode_Impl(IStringify *stringify, IParser *parser,
+               const ArenaOptions *arenaOptions = nullptr);
   Bencode_Impl(const Bencode_Impl &other) = delete;
   Bencode_Impl &operator=(const Bencode_Impl &other) = delete;
   Bencode_Impl(Bencode_Impl &&other) = delete;
@@ -52,6 +53,8 @@ public:
   // Traverse Node tree
   void traverse(IAction &action);
   void traverse(IAction &action) const;
+  // Promote borrowed strings and keys
+  void promote();
   // Search for Bencode dictionary entry with a given key
   Node &operator[](const std::string_view &key);
   const Node &operator[](const std::string_view &key) const;
@@ -85,6 +88,8 @@ private:
 
   // Traverse Bencode Node tree
   template <typename T> static void traverseNodes(T &bNode, IAction &action);
+  // Optional arena for the Node tree (must outlive it)
+  std::unique_ptr<Bencode_Arena> arena{};
   // Root of Node tree
   Node bNodeRoot;
   // Bencode stringify
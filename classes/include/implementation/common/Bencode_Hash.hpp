@@ -0,0 +1,53 @@
+// File: Bencode_Hash.hpp
+//
+// Description: Incremental SHA-1/SHA-256 hashing used to compute torrent info-hashes from raw encoded bytes.
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Bencode_Lib {
+
+enum class HashAlgorithm { None, SHA1, SHA256 };
+
+// Bytes are fed in any number of update() calls; digest() pads the message
+// and returns the raw digest (20 bytes for SHA-1, 32 for SHA-256).
+class Hasher {
+
+public:
+  // Constructors/Destructors
+  explicit Hasher(HashAlgorithm algorithm = HashAlgorithm::SHA1);
+  Hasher(const Hasher &other) = default;
+  Hasher &operator=(const Hasher &other) = default;
+  Hasher(Hasher &&other) = default;
+  Hasher &operator=(Hasher &&other) = default;
+  ~Hasher() = default;
+  // Add message bytes
+  void update(std::string_view bytes);
+  void update(char byte);
+  // Finish the message returning its digest (the hasher is then reset)
+  [[nodiscard]] std::string digest();
+  // Start a new message
+  void reset();
+  [[nodiscard]] HashAlgorithm algorithm() const { return hashAlgorithm; }
+  // Lower case hexadecimal form of a digest
+  [[nodiscard]] static std::string toHex(std::string_view digest);
+
+private:
+  void compress(const unsigned char *block);
+  void compressSHA1(const unsigned char *block);
+  void compressSHA256(const unsigned char *block);
+
+  HashAlgorithm hashAlgorithm;
+  std::array<std::uint32_t, 8> state{};
+  std::array<unsigned char, 64> block{};
+  std::size_t blockUsed = 0;
+  std::uint64_t messageLength = 0;
+};
+
+} // namespace Bencode_Lib
@@ -0,0 +1,80 @@
+// File: Bencode_Integer_Format.hpp
+//
+// Description: Allocation free decimal formatting of integers shared by the stringifiers.
+//
+
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+
+namespace Bencode_Lib {
+
+// Decimal text of an integer held in the object itself, so formatting never
+// allocates; digits are produced two at a time from a lookup table of the
+// pairs "00" to "99" and written backwards from the end of the buffer.
+class IntegerFormat {
+
+public:
+  template <std::integral T> explicit IntegerFormat(const T value) {
+    if constexpr (std::signed_integral<T>) {
+      if (value < 0) {
+        // Negated one short of the value so the most negative one fits
+        format(static_cast<unsigned long long>(-(value + 1)) + 1ull);
+        digits[--start] = '-';
+        return;
+      }
+    }
+    format(static_cast<unsigned long long>(value));
+  }
+  [[nodiscard]] std::string_view view() const {
+    return {digits.data() + start, digits.size() - start};
+  }
+
+  // Number of decimal digits in a value
+  [[nodiscard]] static constexpr std::size_t
+  digitCount(unsigned long long value) {
+    std::size_t count = 1;
+    for (; value >= 10000; value /= 10000) {
+      count += 4;
+    }
+    return count + (value >= 10) + (value >= 100) + (value >= 1000);
+  }
+
+private:
+  // Sign and the 20 digits of the largest unsigned 64 bit value
+  constexpr static std::size_t kMaxLength = 21;
+  constexpr static std::array<char, 200> kDigitPairs = [] {
+    std::array<char, 200> pairs{};
+    for (std::size_t pair = 0; pair < 100; ++pair) {
+      pairs[pair * 2] = static_cast<char>('0' + pair / 10);
+      pairs[(pair * 2) + 1] = static_cast<char>('0' + pair % 10);
+    }
+    return pairs;
+  }();
+
+  void format(unsigned long long value) {
+    while (value >= 100) {
+      const auto pair = static_cast<std::size_t>(value % 100) * 2;
+      value /= 100;
+      start -= 2;
+      std::memcpy(digits.data() + start, kDigitPairs.data() + pair, 2);
+    }
+    if (value >= 10) {
+      start -= 2;
+      std::memcpy(digits.data() + start,
+                  kDigitPairs.data() + (static_cast<std::size_t>(value) * 2),
+                  2);
+    } else {
+      digits[--start] = static_cast<char>('0' + value);
+    }
+  }
+
+  std::array<char, kMaxLength> digits;
+  std::size_t start{kMaxLength};
+};
+
+} // namespace Bencode_Lib
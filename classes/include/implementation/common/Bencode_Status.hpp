@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 namespace Bencode_Lib {
@@ -32,16 +33,23 @@ enum class ErrorCode : int {
   FileOpenFailure,
   FileWriteFailure,
   FixedVectorCapacityExceeded,
+  UnexpectedEndOfSource,
 };
 
 struct ParseStatus {
+  // Offset value when the error position is not known
+  static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
   ErrorCode code{ErrorCode::None};
   std::string message{};
+  // Source offset at which the error was found (if known)
+  std::size_t offset{npos};
 
   constexpr bool ok() const noexcept { return code == ErrorCode::None; }
   static ParseStatus success() { return ParseStatus{}; }
-  static ParseStatus failure(const ErrorCode errorCode, std::string message) {
-    return ParseStatus{errorCode, std::move(message)};
+  static ParseStatus failure(const ErrorCode errorCode, std::string message,
+                             const std::size_t offset = npos) {
+    return ParseStatus{errorCode, std::move(message), offset};
   }
 };
 
@@ -11,7 +11,7 @@
 #include <cstring>
 #include <string>
 #include <string_view>
-#include <vector>
+#include <utility>
 
 namespace Bencode_Lib {
 
@@ -29,39 +29,30 @@ public:
   ~BufferDestination() override = default;
 
   void add(const std::string &sourceBuffer) override {
-    for (auto ch : sourceBuffer) {
-      encodeBuffer.push_back(static_cast<std::byte>(ch));
-    }
+    encodeBuffer.append(sourceBuffer);
   }
   void add(const std::string_view &sourceBuffer) override {
-    for (auto ch : sourceBuffer) {
-      encodeBuffer.push_back(static_cast<std::byte>(ch));
-    }
+    encodeBuffer.append(sourceBuffer);
   }
   void add(const char *sourceBuffer) override {
-    for (std::size_t index = 0; index < strlen(sourceBuffer); index++) {
-      encodeBuffer.push_back(static_cast<std::byte>(sourceBuffer[index]));
-    }
-  }
-  void add(const char ch) override {
-    encodeBuffer.push_back(static_cast<std::byte>(ch));
+    encodeBuffer.append(sourceBuffer, std::strlen(sourceBuffer));
   }
+  void add(const char ch) override { encodeBuffer.push_back(ch); }
   void clear() override { encodeBuffer.clear(); }
 
+  // Make room for size bytes in total (e.g. Default_Stringify::encodedSize())
+  void reserve(const std::size_t size) { encodeBuffer.reserve(size); }
   [[nodiscard]] std::size_t size() const { return encodeBuffer.size(); }
-  std::string toString() const {
-    std::string destination;
-    for (auto ch : encodeBuffer) {
-      destination.push_back(static_cast<char>(ch));
-    }
-    return destination;
-  }
-  [[nodiscard]] char last() override {
-    return static_cast<char>(encodeBuffer.back());
+  [[nodiscard]] std::string_view view() const { return encodeBuffer; }
+  std::string toString() const { return encodeBuffer; }
+  // Move the encoding out leaving the destination empty
+  [[nodiscard]] std::string release() {
+    return std::exchange(encodeBuffer, std::string{});
   }
+  [[nodiscard]] char last() override { return encodeBuffer.back(); }
 
 private:
-  std::vector<std::byte> encodeBuffer;
+  std::string encodeBuffer;
 };
 
 } // namespace Bencode_Lib
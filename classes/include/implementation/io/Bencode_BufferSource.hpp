@@ -7,22 +7,40 @@
 
 #include "ISource.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
+#include <span>
+#include <string>
 #include <string_view>
-#include <vector>
 
 namespace Bencode_Lib {
 
+// BufferSource borrows the memory it is given by default: the caller's buffer
+// must outlive the source and stay unmodified until parsing has finished.
+// Passing an rvalue std::string selects the owning mode, where the source
+// takes the string over (by move) and no lifetime rules apply.
 class BufferSource final : public ISource {
 
 public:
   // Constructors/Destructors
-  explicit BufferSource(const std::string_view &sourceBuffer) {
+  explicit BufferSource(const std::string_view &sourceBuffer)
+      : bufferStart(sourceBuffer.data()), bufferLength(sourceBuffer.size()) {
     if (sourceBuffer.empty()) {
       throw Error("Empty source buffer passed to be parsed.");
     }
-    for (auto ch : sourceBuffer) {
-      parseBuffer.push_back(static_cast<std::byte>(ch));
+  }
+  explicit BufferSource(const char *sourceBuffer)
+      : BufferSource(std::string_view(sourceBuffer)) {}
+  explicit BufferSource(const std::span<const std::byte> sourceBuffer)
+      : BufferSource(
+            std::string_view(reinterpret_cast<const char *>(sourceBuffer.data()),
+                             sourceBuffer.size())) {}
+  explicit BufferSource(std::string &&sourceBuffer)
+      : ownedBuffer(std::move(sourceBuffer)), bufferStart(ownedBuffer.data()),
+        bufferLength(ownedBuffer.size()) {
+    if (ownedBuffer.empty()) {
+      throw Error("Empty source buffer passed to be parsed.");
     }
   }
   BufferSource() = delete;
@@ -33,10 +51,8 @@ public:
   ~BufferSource() override = default;
 
   [[nodiscard]] char current() const override {
-    if (more()) {
-      return static_cast<char>(parseBuffer[static_cast<int>(bufferPosition)]);
-    }
-    return EOF;
+    return bufferPosition < bufferLength ? bufferStart[bufferPosition]
+                                         : static_cast<char>(EOF);
   }
   void next() override {
     if (!more()) {
@@ -45,13 +61,40 @@ public:
     bufferPosition++;
   }
   [[nodiscard]] bool more() const override {
-    return bufferPosition < parseBuffer.size();
+    return bufferPosition < bufferLength;
   }
   void reset() override { bufferPosition = 0; }
+  [[nodiscard]] std::size_t position() const override { return bufferPosition; }
+  [[nodiscard]] std::string_view peek(const std::size_t count) const override {
+    return std::string_view(bufferStart + bufferPosition,
+                            std::min(count, bufferLength - bufferPosition));
+  }
+  void read(char *buffer, const std::size_t count) override {
+    ensureAvailable(count);
+    std::memcpy(buffer, bufferStart + bufferPosition, count);
+    bufferPosition += count;
+  }
+  void skip(const std::size_t count) override {
+    ensureAvailable(count);
+    bufferPosition += count;
+  }
+  // Borrowed buffers belong to the caller so views outlive the source
+  [[nodiscard]] bool stable() const override { return !isOwning(); }
+  [[nodiscard]] bool contiguous() const override { return true; }
+  // Is the source buffer owned (rather than borrowed from the caller) ?
+  [[nodiscard]] bool isOwning() const { return !ownedBuffer.empty(); }
 
 private:
+  void ensureAvailable(const std::size_t count) const {
+    if (count > bufferLength - bufferPosition) {
+      throw Error("Parse buffer empty before parse complete.");
+    }
+  }
+
+  std::string ownedBuffer;
+  const char *bufferStart;
+  std::size_t bufferLength;
   std::size_t bufferPosition = 0;
-  std::vector<std::byte> parseBuffer;
 };
 
-} // namespace Bencode_Lib
\ No newline at end of file
+} // namespace Bencode_Lib
@@ -0,0 +1,69 @@
+// File: Bencode_ContainerDestination.hpp
+//
+// Description: Destination adapter that appends Bencoded output to a caller supplied std::string or std::vector<char>.
+//
+
+#pragma once
+
+#include "IDestination.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Bencode_Lib {
+
+// Output is appended to the container, which stays the caller's (so the
+// encoding can simply be moved out of it afterwards). Reserving the exact
+// encoded size first (see Default_Stringify::encodedSize()) means every
+// add() is a bulk copy with no reallocation.
+template <typename Container>
+  requires std::same_as<Container, std::string> ||
+           std::same_as<Container, std::vector<char>>
+class ContainerDestination final : public IDestination {
+
+public:
+  // Constructors/Destructors
+  explicit ContainerDestination(Container &container)
+      : container(container), start(container.size()) {}
+  ContainerDestination() = delete;
+  ContainerDestination(const ContainerDestination &other) = delete;
+  ContainerDestination &operator=(const ContainerDestination &other) = delete;
+  ContainerDestination(ContainerDestination &&other) = delete;
+  ContainerDestination &operator=(ContainerDestination &&other) = delete;
+  ~ContainerDestination() override = default;
+
+  void add(const std::string &bytes) override {
+    append(bytes.data(), bytes.size());
+  }
+  void add(const std::string_view &bytes) override {
+    append(bytes.data(), bytes.size());
+  }
+  void add(const char *bytes) override { append(bytes, std::strlen(bytes)); }
+  void add(const char ch) override { container.push_back(ch); }
+  // Remove only what this destination has written
+  void clear() override { container.resize(start); }
+  [[nodiscard]] char last() override { return container.back(); }
+
+  // Make room for size more bytes
+  void reserve(const std::size_t size) {
+    container.reserve(container.size() + size);
+  }
+
+private:
+  void append(const char *bytes, const std::size_t length) {
+    if constexpr (std::same_as<Container, std::string>) {
+      container.append(bytes, length);
+    } else {
+      container.insert(container.end(), bytes, bytes + length);
+    }
+  }
+
+  Container &container;
+  std::size_t start;
+};
+
+} // namespace Bencode_Lib
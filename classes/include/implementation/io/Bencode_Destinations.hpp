@@ -6,7 +6,9 @@
 #pragma once
 
 #include "Bencode_BufferDestination.hpp"
+#include "Bencode_ContainerDestination.hpp"
 
 #if BENCODE_ENABLE_FILE_IO
 #include "Bencode_FileDestination.hpp"
+#include "Bencode_GatherDestination.hpp"
 #endif
\ No newline at end of file
@@ -14,32 +14,29 @@
 #include <cstring>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace Bencode_Lib {
 
+// Output is collected in a user-space buffer and written to the file a
+// buffer at a time (writes larger than the buffer go straight to the file).
+// flush() hands buffered bytes to the operating system, sync() also asks it
+// to commit them to storage (fsync) and close() flushes then closes the file;
+// destruction closes the file but ignores write errors, so call close() to
+// have them reported.
 class FileDestination final : public IDestination {
 
 public:
+  constexpr static std::size_t kDefaultBufferSize = 64 * 1024;
   // Constructors/Destructors
-  explicit FileDestination(const std::string_view filename)
-      : destination(nullptr), filename(filename), length(0), lastChar(0) {
-#ifdef _MSC_VER
-    if (fopen_s(&destination, this->filename.c_str(), "wb") != 0 ||
-        !destination) {
-#else
-    destination = std::fopen(this->filename.c_str(), "wb");
-    if (!destination) {
-#endif
-      throw Error("Bencode file output stream failed to open or could not be "
-                  "created.");
-    }
-  }
+  explicit FileDestination(std::string_view filename,
+                           std::size_t bufferSize = kDefaultBufferSize);
   FileDestination() = delete;
   FileDestination(const FileDestination &other) = delete;
   FileDestination &operator=(const FileDestination &other) = delete;
   FileDestination(FileDestination &&other) = delete;
   FileDestination &operator=(FileDestination &&other) = delete;
-  ~FileDestination() override { close(); }
+  ~FileDestination() override;
 
   void add(const std::string &bytes) override {
     writeBytes(bytes.data(), bytes.length());
@@ -50,53 +47,38 @@ public:
   void add(const char *bytes) override {
     writeBytes(bytes, std::strlen(bytes));
   }
-  void add(const char ch) override { writeBytes(&ch, 1); }
-
-  void clear() override {
-    if (destination) {
-      std::fclose(destination);
+  void add(const char ch) override {
+    if (buffered == buffer.size() || !destination) {
+      flushBuffer();
     }
-#ifdef _MSC_VER
-    if (fopen_s(&destination, filename.c_str(), "wb") != 0 || !destination) {
-#else
-    destination = std::fopen(filename.c_str(), "wb");
-    if (!destination) {
-#endif
-      throw Error("File output stream failed to open or could not be created.");
-    }
-    length = 0;
-    lastChar = 0;
+    buffer[buffered++] = ch;
+    ++length;
+    lastChar = ch;
   }
+  // Discard everything written and start the file again
+  void clear() override;
 
+  // Bytes written (including any still buffered)
   std::size_t size() const { return length; }
   [[nodiscard]] char last() override { return lastChar; }
 
   std::string getFileName() { return filename; }
-  void close() {
-    if (destination) {
-      std::fclose(destination);
-      destination = nullptr;
-    }
-  }
+  // Write buffered bytes to the file
+  void flush();
+  // Flush and commit the file contents to storage
+  void sync();
+  // Flush and close the file
+  void close();
 
 private:
-  void writeBytes(const char *data, std::size_t size) {
-    if (!destination) {
-      throw Error("File output stream is not open.");
-    }
-    std::size_t written = std::fwrite(data, 1, size, destination);
-    if (written != size) {
-      throw Error("Failed to write bytes to file output stream.");
-    }
-    std::fflush(destination);
-    length += written;
-    if (size > 0) {
-      lastChar = data[size - 1];
-    }
-  }
+  void writeBytes(const char *data, std::size_t size);
+  void flushBuffer();
+  void open();
 
   FILE *destination;
   std::string filename;
+  std::vector<char> buffer;
+  std::size_t buffered{};
   std::size_t length{};
   char lastChar{};
 };
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdio>
 #include <string>
 #include <string_view>
@@ -13,6 +14,28 @@ namespace Bencode_Lib {
 
 bool openBencodeFileForRead(const std::string &path, FILE *&file);
 bool openBencodeFileForWrite(const std::string &path, FILE *&file);
+// Read up to length bytes from the file's underlying descriptor, returning
+// the number read (0 at end of file); partial reads are returned as soon as
+// data is available so pipes are not stalled waiting for a full block.
+std::size_t readBencodeFileBlock(FILE *file, char *buffer, std::size_t length);
+// Reposition the file's underlying descriptor to its start (false if the
+// stream is not seekable, e.g. a pipe)
+bool rewindBencodeFile(FILE *file);
+// Commit data written to the file's underlying descriptor to storage
+bool syncBencodeFile(FILE *file);
+// Descriptor underlying an open file
+int bencodeFileDescriptor(FILE *file);
+// Write all the segments, in order, to a descriptor (gathered with writev()
+// where available), retrying partial and interrupted writes
+bool writeBencodeSegments(int descriptor, const std::string_view *segments,
+                          std::size_t count);
+// Map a file read-only into memory. Files that cannot be mapped (pipes,
+// devices, empty files) are read into fallback instead; data/length then
+// refer to it and mapped is false.
+bool mapBencodeFileForRead(const std::string &path, const char *&data,
+                           std::size_t &length, bool &mapped,
+                           std::string &fallback);
+void unmapBencodeFile(const char *data, std::size_t length);
 
 class Bencode_FileHandle {
 public:
@@ -9,29 +9,30 @@
 
 #include "ISource.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdio>
+#include <cstring>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace Bencode_Lib {
 
+// Input is read a block at a time into an internal buffer and served from
+// there, so it works equally for regular files, pipes and stdin.
 class FileSource final : public ISource {
 
 public:
+  constexpr static std::size_t kDefaultBlockSize = 64 * 1024;
   // Constructors/Destructors
-  explicit FileSource(const std::string_view &sourceFileName)
-      : source(nullptr), currentChar(EOF), hasPeek(false),
-        filename(sourceFileName) {
-#ifdef _MSC_VER
-    if (fopen_s(&source, filename.c_str(), "rb") != 0 || !source) {
-#else
-    source = std::fopen(filename.c_str(), "rb");
-    if (!source) {
-#endif
-      throw Error(
-          "Bencode file input stream failed to open or does not exist.");
-    }
-  }
+  explicit FileSource(const std::string_view &sourceFileName,
+                      std::size_t blockSize = kDefaultBlockSize);
+  // Read from an already open stream (e.g. stdin or a pipe) that has not
+  // been read from through stdio; the stream is not closed by the source.
+  explicit FileSource(FILE *sourceStream,
+                      const std::string_view &streamName = "stdin",
+                      std::size_t blockSize = kDefaultBlockSize);
   FileSource() = delete;
   FileSource(const FileSource &other) = delete;
   FileSource &operator=(const FileSource &other) = delete;
@@ -40,58 +41,58 @@ public:
   ~FileSource() override { close(); }
 
   char current() const override {
-    ensurePeek();
-    return currentChar != EOF ? static_cast<char>(currentChar) : EOF;
+    if (bufferPosition == bufferFilled && !fill(1)) {
+      return static_cast<char>(EOF);
+    }
+    return buffer[bufferPosition];
   }
   void next() override {
     if (!more()) {
       throw Error("Parse buffer empty before parse complete.");
     }
-    if (!hasPeek) {
-      ensurePeek();
-    }
-    std::fgetc(source);
-    hasPeek = false;
+    bufferPosition++;
   }
-  bool more() const override {
-    ensurePeek();
-    return currentChar != EOF;
+  [[nodiscard]] bool more() const override {
+    return bufferPosition < bufferFilled || fill(1);
   }
-  void reset() override {
-    if (source) {
-      std::rewind(source);
-      hasPeek = false;
-      currentChar = EOF;
-    }
+  void reset() override;
+  [[nodiscard]] std::size_t position() const override {
+    return bufferOffset + bufferPosition;
   }
+  [[nodiscard]] std::string_view peek(const std::size_t count) const override {
+    fill(count);
+    return std::string_view(buffer.data() + bufferPosition,
+                            std::min(count, bufferFilled - bufferPosition));
+  }
+  void read(char *destination, std::size_t count) override;
+  void skip(std::size_t count) override;
   std::string getFileName() { return filename; }
   void close() {
-    if (source) {
+    if (source && ownsSource) {
       std::fclose(source);
-      source = nullptr;
-      hasPeek = false;
-      currentChar = EOF;
     }
+    source = nullptr;
+    bufferPosition = 0;
+    bufferFilled = 0;
   }
 
 private:
-  void ensurePeek() const {
-    if (hasPeek || !source) {
-      return;
-    }
-    currentChar = std::fgetc(source);
-    if (currentChar != EOF) {
-      std::ungetc(currentChar, source);
-    }
-    hasPeek = true;
-  }
+  // Make at least count unread bytes available in the buffer (fewer at end
+  // of input); returns false if none are available.
+  bool fill(std::size_t count) const;
+  std::size_t readBlock(char *destination, std::size_t length) const;
 
   mutable FILE *source;
-  mutable int currentChar;
-  mutable bool hasPeek;
+  bool ownsSource;
   std::string filename;
+  mutable std::vector<char> buffer;
+  mutable std::size_t bufferPosition = 0;
+  mutable std::size_t bufferFilled = 0;
+  // Stream offset of the first byte held in the buffer
+  mutable std::size_t bufferOffset = 0;
+  mutable bool endOfInput = false;
 };
 
 } // namespace Bencode_Lib
 
-#endif // BENCODE_ENABLE_FILE_IO
\ No newline at end of file
+#endif // BENCODE_ENABLE_FILE_IO
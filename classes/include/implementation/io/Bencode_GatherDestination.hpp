@@ -0,0 +1,100 @@
+// File: Bencode_GatherDestination.hpp
+//
+// Description: Scatter-gather destination that writes string payloads straight from node storage.
+//
+
+#pragma once
+
+#if BENCODE_ENABLE_FILE_IO
+
+#include "IDestination.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Bencode_Lib {
+
+// Output is gathered as a list of segments and written with writev() (in
+// batches of IOV_MAX) instead of being copied into one buffer. Pieces passed
+// to reference() of at least referenceSize bytes (Default_Stringify passes
+// string payloads and dictionary keys this way) are referenced in place;
+// everything added with add() (length prefixes, integers, 'i', 'l', 'd', 'e'
+// and any other output) is copied into a side buffer. Referenced bytes must
+// stay valid and unchanged until the next flush(), so stringify a tree and
+// flush before modifying or destroying it. Segments are written when the
+// side buffer fills, kMaxSegments are pending, on flush()/close() and
+// (ignoring errors) on destruction.
+class GatherDestination final : public IDestination {
+
+public:
+  constexpr static std::size_t kDefaultReferenceSize = 128;
+  constexpr static std::size_t kDefaultBufferSize = 64 * 1024;
+  constexpr static std::size_t kMaxSegments = 1024;
+  // Constructors/Destructors
+  explicit GatherDestination(
+      std::string_view filename,
+      std::size_t referenceSize = kDefaultReferenceSize,
+      std::size_t bufferSize = kDefaultBufferSize);
+  // Write to an already open descriptor (file, pipe or socket) which is left
+  // open on destruction
+  explicit GatherDestination(
+      int descriptor, std::size_t referenceSize = kDefaultReferenceSize,
+      std::size_t bufferSize = kDefaultBufferSize);
+  GatherDestination() = delete;
+  GatherDestination(const GatherDestination &other) = delete;
+  GatherDestination &operator=(const GatherDestination &other) = delete;
+  GatherDestination(GatherDestination &&other) = delete;
+  GatherDestination &operator=(GatherDestination &&other) = delete;
+  ~GatherDestination() override;
+
+  void add(const std::string &bytes) override {
+    copyBytes(bytes.data(), bytes.length());
+  }
+  void add(const std::string_view &bytes) override {
+    copyBytes(bytes.data(), bytes.length());
+  }
+  void add(const char *bytes) override { copyBytes(bytes, std::strlen(bytes)); }
+  void add(const char ch) override { copyBytes(&ch, 1); }
+  void reference(const std::string_view &bytes) override {
+    if (bytes.length() >= referenceSize) {
+      referenceBytes(bytes);
+    } else {
+      copyBytes(bytes.data(), bytes.length());
+    }
+  }
+  // Discard pending (unwritten) segments; bytes already written stay
+  void clear() override;
+
+  // Bytes added (including any still pending)
+  std::size_t size() const { return length; }
+  // Bytes added by reference rather than copied
+  std::size_t referencedSize() const { return referenced; }
+  [[nodiscard]] char last() override { return lastChar; }
+
+  // Write pending segments
+  void flush();
+  // Flush and close the file (descriptors passed in are left open)
+  void close();
+
+private:
+  void copyBytes(const char *data, std::size_t size);
+  void referenceBytes(std::string_view bytes);
+
+  FILE *file{};
+  int descriptor{-1};
+  std::size_t referenceSize;
+  std::vector<char> buffer;
+  std::size_t buffered{};
+  std::vector<std::string_view> segments;
+  std::size_t length{};
+  std::size_t referenced{};
+  char lastChar{};
+};
+
+} // namespace Bencode_Lib
+
+#endif // BENCODE_ENABLE_FILE_IO
@@ -0,0 +1,91 @@
+// File: Bencode_MmapFileSource.hpp
+//
+// Description: Source adapter that memory maps a Bencode file and exposes it as one contiguous read-only buffer.
+//
+
+#pragma once
+
+#if BENCODE_ENABLE_FILE_IO
+
+#include "ISource.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace Bencode_Lib {
+
+// Regular files are mapped read-only with sequential/read-ahead hints; pipes
+// and other files that cannot be mapped are read into memory up front. Either
+// way the whole file is then served from one contiguous buffer.
+class MmapFileSource final : public ISource {
+
+public:
+  // Constructors/Destructors
+  explicit MmapFileSource(const std::string_view &sourceFileName);
+  MmapFileSource() = delete;
+  MmapFileSource(const MmapFileSource &other) = delete;
+  MmapFileSource &operator=(const MmapFileSource &other) = delete;
+  MmapFileSource(MmapFileSource &&other) = delete;
+  MmapFileSource &operator=(MmapFileSource &&other) = delete;
+  ~MmapFileSource() override;
+
+  [[nodiscard]] char current() const override {
+    return bufferPosition < bufferLength ? bufferStart[bufferPosition]
+                                         : static_cast<char>(EOF);
+  }
+  void next() override {
+    if (!more()) {
+      throw Error("Parse buffer empty before parse complete.");
+    }
+    bufferPosition++;
+  }
+  [[nodiscard]] bool more() const override {
+    return bufferPosition < bufferLength;
+  }
+  void reset() override { bufferPosition = 0; }
+  [[nodiscard]] std::size_t position() const override { return bufferPosition; }
+  [[nodiscard]] std::string_view peek(const std::size_t count) const override {
+    return std::string_view(bufferStart + bufferPosition,
+                            std::min(count, bufferLength - bufferPosition));
+  }
+  void read(char *buffer, const std::size_t count) override {
+    ensureAvailable(count);
+    std::memcpy(buffer, bufferStart + bufferPosition, count);
+    bufferPosition += count;
+  }
+  void skip(const std::size_t count) override {
+    ensureAvailable(count);
+    bufferPosition += count;
+  }
+  // Views stay valid until the source is destroyed
+  [[nodiscard]] bool stable() const override { return true; }
+  [[nodiscard]] bool contiguous() const override { return true; }
+  // Whole file contents (valid for the lifetime of the source)
+  [[nodiscard]] std::string_view contents() const {
+    return std::string_view(bufferStart, bufferLength);
+  }
+  // Is the file memory mapped (rather than read into a fallback buffer) ?
+  [[nodiscard]] bool isMapped() const { return mapped; }
+  std::string getFileName() { return filename; }
+
+private:
+  void ensureAvailable(const std::size_t count) const {
+    if (count > bufferLength - bufferPosition) {
+      throw Error("Parse buffer empty before parse complete.");
+    }
+  }
+
+  std::string filename;
+  std::string fallbackBuffer;
+  const char *bufferStart = nullptr;
+  std::size_t bufferLength = 0;
+  std::size_t bufferPosition = 0;
+  bool mapped = false;
+};
+
+} // namespace Bencode_Lib
+
+#endif // BENCODE_ENABLE_FILE_IO
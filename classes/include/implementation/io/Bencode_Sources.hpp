@@ -9,4 +9,5 @@
 
 #if BENCODE_ENABLE_FILE_IO
 #include "Bencode_FileSource.hpp"
+#include "Bencode_MmapFileSource.hpp"
 #endif
\ No newline at end of file
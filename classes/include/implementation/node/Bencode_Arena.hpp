@@ -0,0 +1,80 @@
+// File: Bencode_Arena.hpp
+//
+// Description: Monotonic arena that a Bencode document can own to serve all the memory of its Node tree.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+namespace Bencode_Lib {
+
+// Document arena settings
+struct ArenaOptions {
+  // Size of the first arena block (later blocks grow geometrically)
+  std::size_t initialSize = 64 * 1024;
+  // Back the arena with transparent huge pages where supported
+  bool hugePages = false;
+  // Resource the arena blocks are taken from (nullptr for the heap)
+  std::pmr::memory_resource *upstream = nullptr;
+};
+
+// While a Scope is active on a thread, the nodes, containers, strings and
+// keys it creates are allocated from the arena; individual frees are no-ops
+// and everything is released in one step when the arena is released or
+// destroyed, so the arena must outlive any node allocated from it. Arenas are
+// not thread safe: other threads keep allocating from the heap.
+class Bencode_Arena {
+
+public:
+  // ===========================================================
+  // Makes an arena the node memory of the current thread
+  // ===========================================================
+  class Scope {
+  public:
+    explicit Scope(Bencode_Arena *arena) : previous(currentResource) {
+      if (arena != nullptr) {
+        currentResource = &arena->monotonic;
+      }
+    }
+    Scope(const Scope &other) = delete;
+    Scope &operator=(const Scope &other) = delete;
+    Scope(Scope &&other) = delete;
+    Scope &operator=(Scope &&other) = delete;
+    ~Scope() { currentResource = previous; }
+
+  private:
+    std::pmr::memory_resource *previous;
+  };
+  // Constructors/Destructors
+  explicit Bencode_Arena(const ArenaOptions &options = {});
+  Bencode_Arena(const Bencode_Arena &other) = delete;
+  Bencode_Arena &operator=(const Bencode_Arena &other) = delete;
+  Bencode_Arena(Bencode_Arena &&other) = delete;
+  Bencode_Arena &operator=(Bencode_Arena &&other) = delete;
+  ~Bencode_Arena();
+  // Free everything allocated from the arena
+  void release() { monotonic.release(); }
+  // Arena memory resource
+  [[nodiscard]] std::pmr::memory_resource *resource() { return &monotonic; }
+  // Arena active on the current thread (nullptr if none)
+  [[nodiscard]] static std::pmr::memory_resource *current() {
+    return currentResource;
+  }
+
+private:
+  std::unique_ptr<std::pmr::memory_resource> hugePages;
+  std::pmr::monotonic_buffer_resource monotonic;
+  inline static thread_local std::pmr::memory_resource *currentResource =
+      nullptr;
+};
+
+// Memory resource for new node storage: the active arena or the heap
+inline std::pmr::memory_resource *nodeResource() {
+  std::pmr::memory_resource *resource = Bencode_Arena::current();
+  return resource != nullptr ? resource : std::pmr::get_default_resource();
+}
+
+} // namespace Bencode_Lib
@@ -13,6 +13,7 @@
 #include <type_traits>
 #include <variant>
 
+#include "Bencode_Arena.hpp"
 #include "Bencode_Variant.hpp"
 #include "Bencode_Hole.hpp"
 #include "Bencode_Integer.hpp"
@@ -83,7 +84,16 @@ thread_local typename ObjectPool<T>::FreeNode *ObjectPool<T>::freeList =
     nullptr;
 
 template <typename T> struct PoolDeleter {
-  void operator()(T *value) const noexcept { ObjectPool<T>::release(value); }
+  // Arena the value was allocated from (nullptr for the object pool)
+  std::pmr::memory_resource *resource = nullptr;
+  void operator()(T *value) const noexcept {
+    if (resource != nullptr) {
+      value->~T();
+      resource->deallocate(value, sizeof(T), alignof(T));
+      return;
+    }
+    ObjectPool<T>::release(value);
+  }
 };
 
 struct Node {
@@ -169,14 +179,12 @@ private:
   template <typename T, typename... Args>
   explicit Node(std::in_place_type_t<T>, Args &&...args) {
     if constexpr (std::is_same_v<T, List> || std::is_same_v<T, Dictionary>) {
-      T *raw = ObjectPool<T>::acquire();
+      std::pmr::memory_resource *arena = Bencode_Arena::current();
+      T *raw = arena != nullptr
+                   ? static_cast<T *>(arena->allocate(sizeof(T), alignof(T)))
+                   : ObjectPool<T>::acquire();
       new (raw) T(std::forward<Args>(args)...);
-      if constexpr (std::is_same_v<T, List>) {
-        bNodeVariant = std::unique_ptr<List, PoolDeleter<List>>(raw);
-      } else {
-        bNodeVariant =
-            std::unique_ptr<Dictionary, PoolDeleter<Dictionary>>(raw);
-      }
+      bNodeVariant = std::unique_ptr<T, PoolDeleter<T>>(raw, PoolDeleter<T>{arena});
     } else {
       bNodeVariant = T(std::forward<Args>(args)...);
     }
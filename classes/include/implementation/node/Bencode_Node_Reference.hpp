@@ -54,5 +54,20 @@ template <typename T> const T &NRef(const Node &bNode) {
   CheckNodeType<T>(bNode);
   return static_cast<const T &>(bNode.getVariant());
 }
+// Copy every borrowed string and key in a Node tree into owned storage
+inline void promote(Node &bNode) {
+  if (isA<String>(bNode)) {
+    NRef<String>(bNode).promote();
+  } else if (isA<List>(bNode)) {
+    for (auto &entry : NRef<List>(bNode).value()) {
+      promote(entry);
+    }
+  } else if (isA<Dictionary>(bNode)) {
+    for (auto &entry : NRef<Dictionary>(bNode).value()) {
+      entry.promote();
+      promote(entry.getNode());
+    }
+  }
+}
 
 } // namespace Bencode_Lib
\ No newline at end of file
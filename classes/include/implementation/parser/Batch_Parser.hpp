@@ -0,0 +1,68 @@
+// File: Batch_Parser.hpp
+//
+// Description: Header declaring the batch parser that parses many Bencode buffers or files across a pool of worker threads.
+//
+
+#pragma once
+
+#include "Bencode.hpp"
+#include "Bencode_Core.hpp"
+#include "Bencode_Parse_Options.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Bencode_Lib {
+
+// Items are handed out one at a time from a shared queue, so a worker that
+// finishes early takes the next item instead of waiting on a large one.
+// Each item is parsed by Default_Parser and a failure only affects its own
+// result; results are returned in input order. Parse options (string storage,
+// source ranges, key path hashing) apply to every item.
+class Batch_Parser {
+
+public:
+  // Parsed item: its tree or, if it could not be parsed, why
+  struct Result {
+    Node root;
+    ParseStatus status;
+    // Raw digest of the hashed key path (empty if none was requested/found)
+    std::string digest;
+    // File the tree borrows from (parseFiles() with borrowed strings or
+    // source ranges only), kept open for as long as the result is
+    std::shared_ptr<const ISource> source;
+    [[nodiscard]] bool ok() const { return status.ok(); }
+  };
+  // Constructors/Destructors
+  // Worker count (0 for the hardware thread count)
+  explicit Batch_Parser(unsigned int threads = 0,
+                        const ParseOptions &options = {});
+  Batch_Parser(const Batch_Parser &other) = delete;
+  Batch_Parser &operator=(const Batch_Parser &other) = delete;
+  Batch_Parser(Batch_Parser &&other) = default;
+  Batch_Parser &operator=(Batch_Parser &&other) = default;
+  ~Batch_Parser() = default;
+  // Parse encoded buffers
+  [[nodiscard]] std::vector<Result>
+  parseBuffers(const std::vector<std::string_view> &buffers) const;
+#if BENCODE_ENABLE_FILE_IO
+  // Parse files (memory mapped where possible)
+  [[nodiscard]] std::vector<Result>
+  parseFiles(const std::vector<std::string> &fileNames) const;
+#endif
+  // Number of workers
+  [[nodiscard]] unsigned int workers() const { return threads; }
+
+private:
+  void run(std::size_t count,
+           const std::function<void(std::size_t)> &parseItem) const;
+
+  unsigned int threads;
+  ParseOptions options;
+};
+
+} // namespace Bencode_Lib
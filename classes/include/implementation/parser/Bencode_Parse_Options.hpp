@@ -0,0 +1,34 @@
+// File: Bencode_Parse_Options.hpp
+//
+// Description: Options controlling how Default_Parser (and parsers built on it) store strings and what they record while parsing.
+//
+
+#pragma once
+
+#include "Bencode_Hash.hpp"
+
+#include <string>
+#include <vector>
+
+namespace Bencode_Lib {
+
+// Where parsed string values and dictionary keys keep their bytes: copied
+// into the tree (the default) or borrowed as views of the source buffer.
+// Borrowing only applies to stable sources (see ISource::stable()) and the
+// caller must keep the buffer pinned while the tree is in use.
+enum class StringStorage { Owned, Borrowed };
+
+// Default_Parser options
+struct ParseOptions {
+  StringStorage strings = StringStorage::Owned;
+  // Record the source bytes spanned by each list and dictionary (sources
+  // that track their position only) so that unmodified containers can be
+  // re-emitted verbatim by Default_Stringify
+  bool sourceRanges = false;
+  // Hash the encoded bytes of the value at a dictionary key path (empty for
+  // the root value) as they are read, e.g. {"info"} for a torrent info-hash
+  HashAlgorithm hash = HashAlgorithm::None;
+  std::vector<std::string> hashPath{};
+};
+
+} // namespace Bencode_Lib
@@ -7,10 +7,15 @@
 
 #include "Bencode.hpp"
 #include "Bencode_Core.hpp"
+#include "Bencode_Parse_Options.hpp"
 #include "Bencode_Parser_Constants.hpp"
 
+#include <string>
+
 namespace Bencode_Lib {
 
+class HashingSource;
+
 class Default_Parser final : public IParser {
 
 public:
@@ -18,6 +23,9 @@ public:
       ParserConstants::DEFAULT_MAX_PARSER_DEPTH;
   // Constructors/Destructors
   Default_Parser() = default;
+  explicit Default_Parser(const StringStorage storage)
+      : options{.strings = storage} {}
+  explicit Default_Parser(const ParseOptions &options) : options(options) {}
   Default_Parser(const Default_Parser &other) = delete;
   Default_Parser &operator=(const Default_Parser &other) = delete;
   Default_Parser(Default_Parser &&other) = delete;
@@ -34,53 +42,62 @@ public:
     maxParserDepth = depth;
   }
   static unsigned long getMaxParserDepth() { return maxParserDepth; }
+  // Raw digest of the hash key path value from the last parse (empty if the
+  // path was not found or no hash was requested)
+  [[nodiscard]] const std::string &digest() const { return pathDigest; }
 
 private:
   // Parser functions
 #if BENCODE_ENABLE_EXCEPTIONS
   [[nodiscard]] static Bencode::IntegerType extractInteger(ISource &source);
-  [[nodiscard]] static Node parseString(ISource &source,
-                                        unsigned long parserDepth);
+  [[nodiscard]] Node parseString(ISource &source, unsigned long parserDepth);
   [[nodiscard]] static std::string parseStringKey(ISource &source,
                                                   unsigned long parserDepth);
   static void parseStringKey(ISource &source, unsigned long parserDepth,
                              std::string &destination);
   [[nodiscard]] static Node parseInteger(ISource &source,
                                          unsigned long parserDepth);
-  [[nodiscard]] static Node parseDictionary(ISource &source,
-                                            unsigned long parserDepth);
-  [[nodiscard]] static Node parseList(ISource &source,
-                                      unsigned long parserDepth);
-  [[nodiscard]] static Node parseScalar(ISource &source,
-                                        unsigned long parserDepth);
+  [[nodiscard]] Node parseDictionary(ISource &source,
+                                     unsigned long parserDepth);
+  [[nodiscard]] Node parseList(ISource &source, unsigned long parserDepth);
+  [[nodiscard]] Node parseScalar(ISource &source, unsigned long parserDepth);
   void static confirmBoundary(ISource &source, char expectedBoundary);
-  [[nodiscard]] static Node parseNodes(ISource &source,
-                                       unsigned long parserDepth);
-  [[nodiscard]] static Node parseIterative(ISource &source);
+  [[nodiscard]] Node parseNodes(ISource &source, unsigned long parserDepth);
+  [[nodiscard]] Node parseIterative(ISource &source);
 #else
   [[nodiscard]] static ParseStatus extractInteger(ISource &source,
                                                   Bencode::IntegerType &value);
-  [[nodiscard]] static ParseStatus
+  [[nodiscard]] ParseStatus
   parseString(ISource &source, unsigned long parserDepth, Node &destination);
   [[nodiscard]] static ParseStatus parseStringKey(ISource &source,
                                                   unsigned long parserDepth,
                                                   std::string &destination);
   [[nodiscard]] static ParseStatus
   parseInteger(ISource &source, unsigned long parserDepth, Node &destination);
-  [[nodiscard]] static ParseStatus parseDictionary(ISource &source,
-                                                   unsigned long parserDepth,
-                                                   Node &destination);
-  [[nodiscard]] static ParseStatus
+  [[nodiscard]] ParseStatus parseDictionary(ISource &source,
+                                            unsigned long parserDepth,
+                                            Node &destination);
+  [[nodiscard]] ParseStatus
   parseList(ISource &source, unsigned long parserDepth, Node &destination);
-  [[nodiscard]] static ParseStatus
+  [[nodiscard]] ParseStatus
   parseScalar(ISource &source, unsigned long parserDepth, Node &destination);
   [[nodiscard]] static ParseStatus confirmBoundary(ISource &source,
                                                    char expectedBoundary);
-  [[nodiscard]] static ParseStatus
+  [[nodiscard]] ParseStatus
   parseNodes(ISource &source, unsigned long parserDepth, Node &destination);
-  [[nodiscard]] static ParseStatus parseIterative(ISource &source,
-                                                  Node &destination);
+  [[nodiscard]] ParseStatus parseIterative(ISource &source,
+                                           Node &destination);
 #endif
+  [[nodiscard]] bool borrowing(const ISource &source) const {
+    return options.strings == StringStorage::Borrowed && source.stable();
+  }
+  [[nodiscard]] bool recordingRanges(const ISource &source) const {
+    return options.sourceRanges && source.position() != ISource::npos;
+  }
+
+  ParseOptions options;
+  HashingSource *hashTap = nullptr;
+  std::string pathDigest;
   inline static unsigned long maxParserDepth{kMaxParserDepth};
 };
 
@@ -7,12 +7,19 @@
 
 #include "Bencode.hpp"
 #include "Bencode_Core.hpp"
+#include "Bencode_Hash.hpp"
 #include "Bencode_Parser_Constants.hpp"
 
+#include <algorithm>
 #include <array>
+#include <bit>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
 #include <limits>
 #include <string>
 #include <string_view>
+#include <utility>
 
 namespace Bencode_Lib {
 
@@ -23,6 +30,14 @@ struct ParserFrame {
   Node container;
   std::string lastKey;
   std::string currentKey;
+  // Current/last keys when borrowed in place from a stable source
+  std::string_view borrowedKey{};
+  std::string_view lastBorrowedKey{};
+  // Source offset of the container start (when recording ranges)
+  std::size_t sourceBegin = 0;
+  // Keys so far match the hash key path / container is the hashed value
+  bool onHashPath = false;
+  bool hashTarget = false;
   bool awaitingValue = false;
 
   explicit ParserFrame(ContainerType frameType)
@@ -35,14 +50,70 @@ struct ParserFrame {
     lastKey.reserve(64);
     currentKey.reserve(64);
   }
+
+  // Key awaiting its value
+  [[nodiscard]] std::string_view key() const {
+    return borrowedKey.data() != nullptr ? borrowedKey
+                                         : std::string_view(currentKey);
+  }
+  // Dictionary entry for the current key and its value
+  Dictionary::Entry takeEntry(Node &&value) {
+    if (borrowedKey.data() != nullptr) {
+      return Dictionary::Entry(std::exchange(borrowedKey, {}), std::move(value),
+                               Borrowed{});
+    }
+    return Dictionary::Entry(std::move(currentKey), std::move(value));
+  }
 };
 
 inline void copySourceToBuffer(ISource &source, char *buffer,
                                const std::size_t length) {
-  for (std::size_t index = 0; index < length; ++index) {
-    buffer[index] = source.current();
-    source.next();
+  source.read(buffer, length);
+}
+
+// SWAR (SIMD within a register) helpers: eight characters are loaded into a
+// 64 bit word (first character in the low byte) and processed together.
+inline constexpr bool kSWARDigits = std::endian::native == std::endian::little;
+inline constexpr std::uint64_t kSWARZeros = 0x3030303030303030ull;
+
+// Convert eight ASCII digits to their value with three multiply-add steps
+// (pairs, then quads, then the full eight digits).
+inline std::uint64_t decodeEightDigits(std::uint64_t chunk) {
+  chunk -= kSWARZeros;
+  chunk = ((chunk * 10) + (chunk >> 8)) & 0x00FF00FF00FF00FFull;
+  chunk = ((chunk * 100) + (chunk >> 16)) & 0x0000FFFF0000FFFFull;
+  return ((chunk * 10000) + (chunk >> 32)) & 0x00000000FFFFFFFFull;
+}
+
+// Load up to eight digits right aligned behind '0' padding
+inline std::uint64_t loadDigits(const char *digits, const std::size_t count) {
+  std::uint64_t chunk = kSWARZeros;
+  std::memcpy(reinterpret_cast<char *>(&chunk) + (8 - count), digits, count);
+  return chunk;
+}
+
+// Number of leading decimal digits in a buffer
+inline std::size_t countDigits(const char *buffer, const std::size_t length) {
+  std::size_t count = 0;
+  if constexpr (kSWARDigits) {
+    while (length - count >= 8) {
+      std::uint64_t chunk;
+      std::memcpy(&chunk, buffer + count, sizeof(chunk));
+      // High bit set in every byte outside '0'..'9'; bytes before the first
+      // such byte are digits so no carry/borrow can disturb it.
+      const std::uint64_t nonDigits =
+          ((chunk + 0x4646464646464646ull) | (chunk - kSWARZeros)) &
+          0x8080808080808080ull;
+      if (nonDigits != 0) {
+        return count + (std::countr_zero(nonDigits) / 8);
+      }
+      count += 8;
+    }
   }
+  while (count < length && std::isdigit(buffer[count]) != 0) {
+    ++count;
+  }
+  return count;
 }
 
 inline bool convertToInteger(const char *buffer, const std::size_t digits,
@@ -56,21 +127,250 @@ inline bool convertToInteger(const char *buffer, const std::size_t digits,
     limit += 1ull;
   }
   unsigned long long result = 0ull;
-  for (std::size_t index = start; index < digits; ++index) {
-    unsigned int digit = static_cast<unsigned int>(buffer[index] - '0');
-    if (result > (limit - digit) / 10ull) {
+  if (std::size_t remaining = digits - start;
+      kSWARDigits &&
+      remaining <= std::numeric_limits<std::uint64_t>::digits10) {
+    // Cannot overflow 64 bits unsigned so check against the limit once
+    const char *cursor = buffer + start;
+    if (const std::size_t head = remaining % 8; head != 0) {
+      result = decodeEightDigits(loadDigits(cursor, head));
+      cursor += head;
+      remaining -= head;
+    }
+    for (; remaining > 0; cursor += 8, remaining -= 8) {
+      result = (result * 100000000ull) +
+               decodeEightDigits(loadDigits(cursor, 8));
+    }
+    if (result > limit) {
       return false;
     }
-    result = (result * 10ull) + digit;
+  } else {
+    for (std::size_t index = start; index < digits; ++index) {
+      unsigned int digit = static_cast<unsigned int>(buffer[index] - '0');
+      if (result > (limit - digit) / 10ull) {
+        return false;
+      }
+      result = (result * 10ull) + digit;
+    }
   }
   if (negative) {
-    value = -static_cast<Bencode::IntegerType>(result);
+    // Negated unsigned so that the minimum value does not overflow
+    value = static_cast<Bencode::IntegerType>(0ull - result);
   } else {
     value = static_cast<Bencode::IntegerType>(result);
   }
   return true;
 }
 
+// Outcome of scanning an integer (or string length prefix) from a source
+enum class IntegerScan {
+  Ok,
+  TooLarge,
+  EmptyOrLeadingZero,
+  NegativeZero,
+  Overflow
+};
+
+// Sign plus 64 bit integer digits (the terminator lies just beyond)
+using IntegerDigitBuffer =
+    std::array<char, std::numeric_limits<Bencode::IntegerType>::digits10 + 2>;
+
+inline IntegerScan convertIntegerDigits(const char *digits,
+                                        const std::size_t length,
+                                        Bencode::IntegerType &value) {
+  // Check integer has no leading zero and is not empty ('i.e.')
+  if (length == 0 || (digits[0] == '0' && length > 1)) {
+    return IntegerScan::EmptyOrLeadingZero;
+  }
+  // Check-for -0
+  if (digits[0] == ParserConstants::STRING_MINUS && length == 2 &&
+      digits[1] == '0') {
+    return IntegerScan::NegativeZero;
+  }
+  if (!convertToInteger(digits, length, value)) {
+    return IntegerScan::Overflow;
+  }
+  return IntegerScan::Ok;
+}
+
+// ParseStatus for an integer scan (same messages as Default_Parser)
+inline ParseStatus integerScanStatus(const IntegerScan scan) {
+  switch (scan) {
+  case IntegerScan::TooLarge:
+    return ParseStatus::failure(ErrorCode::SyntaxError,
+                                "Integer to large to fit in conversion buffer.");
+  case IntegerScan::EmptyOrLeadingZero:
+    return ParseStatus::failure(ErrorCode::SyntaxError,
+                                "Empty Integer or has leading zero.");
+  case IntegerScan::NegativeZero:
+    return ParseStatus::failure(ErrorCode::SyntaxError,
+                                "Negative zero is not allowed.");
+  case IntegerScan::Overflow:
+    return ParseStatus::failure(ErrorCode::IntegerOverflow,
+                                "Integer conversion overflow.");
+  case IntegerScan::Ok:
+  default:
+    return ParseStatus::success();
+  }
+}
+
+// Extract the optional sign and digits at the current source position and
+// convert them. Sources with contiguous storage are scanned in place (eight
+// bytes at a time, scalar for the tail of the window) and skipped in one
+// step; others are copied a character at a time.
+inline IntegerScan scanInteger(ISource &source, Bencode::IntegerType &value) {
+  IntegerDigitBuffer number{};
+  if (const std::string_view window = source.peek(number.size() + 1);
+      !window.empty()) {
+    std::size_t length =
+        window[0] == ParserConstants::STRING_MINUS ? 1 : 0;
+    length += countDigits(window.data() + length, window.size() - length);
+    // Number too large to fit in buffer
+    if (length > number.size()) {
+      return IntegerScan::TooLarge;
+    }
+    const IntegerScan result =
+        convertIntegerDigits(window.data(), length, value);
+    source.skip(length);
+    return result;
+  }
+  std::size_t digits = 0;
+  if (source.current() == ParserConstants::STRING_MINUS) {
+    number[digits++] = source.current();
+    source.next();
+  }
+  while (source.more() && std::isdigit(source.current()) != 0) {
+    // Number too large to fit in buffer
+    if (digits == number.size()) {
+      return IntegerScan::TooLarge;
+    }
+    number[digits++] = source.current();
+    source.next();
+  }
+  return convertIntegerDigits(number.data(), digits, value);
+}
+
+// Scan a string length prefix and its ':' separator leaving the source on
+// the payload (checks and messages as per Default_Parser)
+inline ParseStatus scanStringLength(ISource &source, std::size_t &length) {
+  Bencode::IntegerType value = 0;
+  if (const IntegerScan scan = scanInteger(source, value);
+      scan != IntegerScan::Ok) {
+    return integerScanStatus(scan);
+  }
+  if (value < 0) {
+    return ParseStatus::failure(ErrorCode::SyntaxError,
+                                "Negative string length.");
+  }
+  if (source.current() != ParserConstants::COLON) {
+    return ParseStatus::failure(ErrorCode::SyntaxError,
+                                "Missing colon separator in string value.");
+  }
+  source.next();
+  if (static_cast<uint64_t>(value) > String::getMaxStringLength()) {
+    return ParseStatus::failure(ErrorCode::SyntaxError,
+                                "String size exceeds maximum allowed size.");
+  }
+  length = static_cast<std::size_t>(value);
+  return ParseStatus::success();
+}
+
+// Source wrapper that feeds the bytes the parser consumes to a hasher while
+// hashing is switched on (used for key path digests)
+class HashingSource final : public ISource {
+public:
+  HashingSource(ISource &source, const HashAlgorithm algorithm)
+      : source(source), hasher(algorithm) {}
+
+  [[nodiscard]] char current() const override { return source.current(); }
+  void next() override {
+    if (hashing) {
+      hasher.update(source.current());
+    }
+    source.next();
+  }
+  [[nodiscard]] bool more() const override { return source.more(); }
+  void reset() override { source.reset(); }
+  [[nodiscard]] std::string_view peek(const std::size_t count) const override {
+    return source.peek(count);
+  }
+  [[nodiscard]] std::size_t position() const override {
+    return source.position();
+  }
+  [[nodiscard]] bool stable() const override { return source.stable(); }
+  [[nodiscard]] bool contiguous() const override {
+    return source.contiguous();
+  }
+  void read(char *buffer, const std::size_t count) override {
+    source.read(buffer, count);
+    if (hashing) {
+      hasher.update(std::string_view(buffer, count));
+    }
+  }
+  void skip(std::size_t count) override {
+    if (!hashing) {
+      source.skip(count);
+      return;
+    }
+    if (const std::string_view bytes = source.peek(count);
+        bytes.size() == count) {
+      hasher.update(bytes);
+      source.skip(count);
+      return;
+    }
+    std::array<char, 4096> buffer;
+    while (count > 0) {
+      const std::size_t length = std::min(count, buffer.size());
+      read(buffer.data(), length);
+      count -= length;
+    }
+  }
+  // Hash the bytes consumed from now on
+  void start() { hashing = true; }
+  // Stop hashing and return the digest of the bytes consumed since start()
+  [[nodiscard]] std::string stop() {
+    hashing = false;
+    return hasher.digest();
+  }
+
+private:
+  ISource &source;
+  Hasher hasher;
+  bool hashing = false;
+};
+
+// Record the source bytes spanned by a completed list or dictionary
+inline void setSourceRange(Node &container, const SourceRange &range) {
+  if (isA<List>(container)) {
+    NRef<List>(container).setSourceRange(range);
+  } else {
+    NRef<Dictionary>(container).setSourceRange(range);
+  }
+}
+
+// Move past a string payload of the given length returning a view of it in
+// place (the source must be stable); a payload cut short raises the same
+// source error as copying it would
+inline std::string_view borrowPayload(ISource &source,
+                                      const std::size_t length) {
+  const std::string_view payload = source.peek(length);
+  source.skip(length);
+  return payload;
+}
+
+#if BENCODE_ENABLE_EXCEPTIONS
+// Raise a failed status as the exception Default_Parser would throw
+inline void throwOnFailure(const ParseStatus &status) {
+  if (status.ok()) {
+    return;
+  }
+  if (status.code == ErrorCode::IntegerOverflow) {
+    throw std::out_of_range(status.message);
+  }
+  throw SyntaxError(status.message);
+}
+#endif
+
 inline ParseStatus attachCompletedValue(ParserFrame &parent, Node &&completed) {
   if (parent.type == ContainerType::List) {
     NRef<List>(parent.container).add(std::move(completed));
@@ -81,8 +381,7 @@ inline ParseStatus attachCompletedValue(ParserFrame &parent, Node &&completed) {
                                 "Dictionary value missing key.");
   }
   NRef<Dictionary>(parent.container)
-      .appendSorted(Dictionary::Entry(std::move(parent.currentKey),
-                                      std::move(completed)));
+      .appendSorted(parent.takeEntry(std::move(completed)));
   parent.awaitingValue = false;
   return ParseStatus::success();
 }
@@ -0,0 +1,55 @@
+// File: Event_Parser.hpp
+//
+// Description: Header declaring the event driven Bencode parser that reports values to an IParseHandler instead of building a Node tree.
+//
+
+#pragma once
+
+#include "Bencode.hpp"
+#include "Bencode_Core.hpp"
+
+#include <string>
+#include <vector>
+
+namespace Bencode_Lib {
+
+// Applies the same validation as Default_Parser (including its maximum
+// depth setting) and reports the same errors, but nothing is allocated per
+// value: strings on contiguous sources are passed to the handler in place.
+class Event_Parser {
+
+public:
+  using ParseResultType = Bencode::ParseResultType;
+  // Constructors/Destructors
+  Event_Parser() = default;
+  Event_Parser(const Event_Parser &other) = delete;
+  Event_Parser &operator=(const Event_Parser &other) = delete;
+  Event_Parser(Event_Parser &&other) = default;
+  Event_Parser &operator=(Event_Parser &&other) = default;
+  ~Event_Parser() = default;
+  // Parse the value at the source position raising events on the handler
+  ParseResultType parse(ISource &source, IParseHandler &handler);
+  ParseResultType parse(ISource &&source, IParseHandler &handler);
+
+private:
+  // Open container
+  struct Frame {
+    bool dictionary = false;
+    bool hasKey = false;
+    bool awaitingValue = false;
+    std::string lastKey{};
+  };
+  [[nodiscard]] ParseStatus parseEvents(ISource &source,
+                                        IParseHandler &handler);
+  [[nodiscard]] ParseStatus parseKey(ISource &source, IParseHandler &handler);
+  [[nodiscard]] ParseStatus parseString(ISource &source,
+                                        IParseHandler &handler);
+  [[nodiscard]] ParseStatus pushFrame(bool dictionary);
+
+  // Frames are popped by resetting the depth so their key buffers are reused
+  std::vector<Frame> frames;
+  std::size_t depth = 0;
+  std::string buffer;
+};
+
+} // namespace Bencode_Lib
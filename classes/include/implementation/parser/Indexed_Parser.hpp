@@ -0,0 +1,74 @@
+// File: Indexed_Parser.hpp
+//
+// Description: Header declaring a two pass Bencode parser that first builds a structural index of the input and then the Node tree from it.
+//
+
+#pragma once
+
+#include "Bencode.hpp"
+#include "Bencode_Core.hpp"
+#include "Bencode_Parser_Constants.hpp"
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace Bencode_Lib {
+
+// Stage one walks a contiguous source once, jumping string payloads by their
+// decoded lengths, and records the position of every structural token. Stage
+// two builds the Node tree from that index without revisiting the input bytes
+// in between. Anything out of the ordinary (malformed input, limits, sources
+// without contiguous storage) is handed to Default_Parser so that errors and
+// ParseStatus results are exactly those of the default engine.
+//
+// Given more than one thread, stage two of a large outermost list or
+// dictionary is split by element across worker threads, each building its
+// own subtrees, which are then spliced into the root container in order
+// (keys still checked for order and duplicates).
+class Indexed_Parser final : public IParser {
+
+public:
+  // Structural token: container start/end, integer digits or string payload
+  struct Token {
+    enum class Kind : unsigned char { Dictionary, List, End, Integer, String };
+    Kind kind;
+    std::size_t offset;
+    std::size_t length;
+  };
+  // Outermost container elements needed before stage two is threaded
+  constexpr static std::size_t kMinParallelElements = 4096;
+  // Constructors/Destructors
+  Indexed_Parser() = default;
+  // Thread count for stage two (0 for the hardware thread count)
+  explicit Indexed_Parser(unsigned int threads);
+  Indexed_Parser(const Indexed_Parser &other) = delete;
+  Indexed_Parser &operator=(const Indexed_Parser &other) = delete;
+  Indexed_Parser(Indexed_Parser &&other) = delete;
+  Indexed_Parser &operator=(Indexed_Parser &&other) = delete;
+  ~Indexed_Parser() override = default;
+  // Parse bencode Node tree
+#if BENCODE_ENABLE_EXCEPTIONS
+  Node parseImpl(ISource &source) override;
+#else
+  ParseStatus parseImpl(ISource &source, Node &destination) override;
+#endif
+  // Build the structural index for the value at the start of a document;
+  // returns the number of bytes it spans or zero if it cannot be indexed.
+  static std::size_t buildIndex(const std::string_view &document,
+                                std::vector<Token> &index);
+
+private:
+  [[nodiscard]] bool parseIndexed(ISource &source, Node &destination);
+  [[nodiscard]] static bool buildTree(const std::string_view &document,
+                                      std::span<const Token> index,
+                                      Node &destination);
+  [[nodiscard]] bool buildParallel(const std::string_view &document,
+                                   Node &destination) const;
+
+  std::vector<Token> tokens;
+  unsigned int threads = 1;
+};
+
+} // namespace Bencode_Lib
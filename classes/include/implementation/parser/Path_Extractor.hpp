@@ -0,0 +1,80 @@
+// File: Path_Extractor.hpp
+//
+// Description: Header declaring the on-demand extractor that pulls values for a set of dictionary key paths out of encoded Bencode in one pass.
+//
+
+#pragma once
+
+#include "Bencode.hpp"
+#include "Bencode_Core.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Bencode_Lib {
+
+// Walks the source once following only the requested key paths. Values off
+// those paths are skipped using their length prefixes without being decoded
+// into nodes; only the requested values are materialized (by Default_Parser).
+// The walk stops as soon as every path has been found or ruled out (keys are
+// sorted), so trailing data such as a torrent's "pieces" blob is never read.
+// Skipped values are checked for structure only.
+class Path_Extractor {
+
+public:
+  // ====================
+  // Path_Extractor Error
+  // ====================
+  struct Error final : std::runtime_error {
+    explicit Error(const std::string_view &message)
+        : std::runtime_error(
+              std::string("Path_Extractor Error: ").append(message)) {}
+  };
+  // Maximum number of paths per extractor
+  constexpr static std::size_t kMaxPaths = 64;
+  // Sequence of dictionary keys from the root (empty is the root itself)
+  using Path = std::vector<std::string>;
+  using ParseResultType = Bencode::ParseResultType;
+  // Constructors/Destructors
+  explicit Path_Extractor(const std::vector<Path> &keyPaths);
+  // Paths given as keys joined by a separator, e.g. "info.piece length"
+  Path_Extractor(std::initializer_list<std::string_view> keyPaths,
+                 char separator = '.');
+  Path_Extractor(const Path_Extractor &other) = delete;
+  Path_Extractor &operator=(const Path_Extractor &other) = delete;
+  Path_Extractor(Path_Extractor &&other) = default;
+  Path_Extractor &operator=(Path_Extractor &&other) = default;
+  ~Path_Extractor() = default;
+  // Extract the requested values of the document at the source position
+  ParseResultType extract(ISource &source);
+  ParseResultType extract(ISource &&source);
+  // Number of paths
+  [[nodiscard]] std::size_t size() const { return paths.size(); }
+  // Was a value found for a path (in construction order) ?
+  [[nodiscard]] bool found(const std::size_t path) const {
+    return results.at(path) != nullptr;
+  }
+  // Value found for a path
+  [[nodiscard]] const Node &operator[](std::size_t path) const;
+
+private:
+  [[nodiscard]] ParseStatus walk(ISource &source, std::uint64_t active,
+                                 std::size_t level);
+  [[nodiscard]] ParseStatus materialize(ISource &source, std::uint64_t active,
+                                        std::size_t level);
+  [[nodiscard]] ParseStatus readKey(ISource &source);
+  [[nodiscard]] static ParseStatus skipValue(ISource &source);
+
+  std::vector<Path> paths;
+  std::vector<Node> values;
+  std::vector<const Node *> results;
+  std::uint64_t pending = 0;
+  std::string key;
+};
+
+} // namespace Bencode_Lib
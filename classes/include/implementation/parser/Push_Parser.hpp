@@ -0,0 +1,87 @@
+// File: Push_Parser.hpp
+//
+// Description: Header declaring the resumable Bencode parser that is fed input in chunks as it arrives.
+//
+
+#pragma once
+
+#include "Bencode.hpp"
+#include "Bencode_Core.hpp"
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Bencode_Lib {
+
+struct ParserFrame;
+
+// Chunks may split the input anywhere (inside an integer, a length prefix or
+// a string payload); the open containers and any partial token are kept
+// between feed() calls. Validation, the maximum depth setting and errors are
+// the same as Default_Parser. After an error the parser is reset.
+class Push_Parser {
+
+public:
+  // =================
+  // Push_Parser Error
+  // =================
+  struct Error final : std::runtime_error {
+    explicit Error(const std::string_view &message)
+        : std::runtime_error(
+              std::string("Push_Parser Error: ").append(message)) {}
+  };
+  using ParseResultType = Bencode::ParseResultType;
+  // Constructors/Destructors
+  Push_Parser();
+  Push_Parser(const Push_Parser &other) = delete;
+  Push_Parser &operator=(const Push_Parser &other) = delete;
+  Push_Parser(Push_Parser &&other) noexcept;
+  Push_Parser &operator=(Push_Parser &&other) noexcept;
+  ~Push_Parser();
+  // Consume the chunk until it is used up or a complete value has arrived
+  // (nothing is consumed until a completed value has been taken)
+  ParseResultType feed(std::string_view chunk);
+  // Has a complete value arrived ?
+  [[nodiscard]] bool complete() const { return state == State::Complete; }
+  // Bytes of the last chunk consumed (any remainder starts the next value)
+  [[nodiscard]] std::size_t consumed() const { return used; }
+  // Take the completed value leaving the parser ready for the next one
+  [[nodiscard]] Node take();
+  // Discard any partial value
+  void reset();
+
+private:
+  // Parser position within the encoding
+  enum class State { Element, Integer, Length, Payload, Complete };
+  // Sign plus 64 bit integer digits
+  using Digits =
+      std::array<char, std::numeric_limits<Bencode::IntegerType>::digits10 + 2>;
+  [[nodiscard]] ParseStatus advance(std::string_view chunk);
+  [[nodiscard]] ParseStatus startElement(char current);
+  [[nodiscard]] ParseStatus addDigit(char current);
+  [[nodiscard]] ParseStatus endInteger(char current);
+  [[nodiscard]] ParseStatus endLength(char current);
+  [[nodiscard]] ParseStatus endPayload();
+  [[nodiscard]] ParseStatus pushFrame(bool dictionary);
+  [[nodiscard]] ParseStatus completeValue(Node &&completed);
+
+  std::vector<ParserFrame> frames;
+  State state = State::Element;
+  // Partial integer or string length
+  Digits digits{};
+  std::size_t digitCount = 0;
+  // Partial string payload (a key is read into its frame)
+  bool readingKey = false;
+  Node stringNode;
+  std::size_t payloadLength = 0;
+  std::size_t payloadRead = 0;
+  Node value;
+  std::size_t used = 0;
+};
+
+} // namespace Bencode_Lib
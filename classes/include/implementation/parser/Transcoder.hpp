@@ -0,0 +1,53 @@
+// File: Transcoder.hpp
+//
+// Description: Header declaring the single pass converter from Bencode to JSON, XML or YAML that never builds a Node tree.
+//
+
+#pragma once
+
+#include "Bencode.hpp"
+#include "Bencode_Core.hpp"
+#include "Bencode_Binary_Encoding.hpp"
+
+#include <cstdint>
+#include <memory>
+
+namespace Bencode_Lib {
+
+enum class TranscodeFormat : std::uint8_t { JSON, XML, YAML };
+
+// Reads the document with Event_Parser (so it is validated exactly as
+// Default_Parser would) and writes each value to the destination as soon as
+// it is read. Only a stack of open containers is kept (bounded by the
+// maximum parser depth), so memory does not grow with the document; strings
+// are passed through in place on contiguous sources. Output matches
+// JSON_Stringify, XML_Stringify and YAML_Stringify for the same options.
+class Transcoder {
+
+public:
+  using ParseResultType = Bencode::ParseResultType;
+  // Constructors/Destructors (a null translator selects the format's own:
+  // XML_Translator for XML, Default_Translator otherwise)
+  explicit Transcoder(TranscodeFormat format,
+                      BinaryEncoding binary = BinaryEncoding::Escape,
+                      std::unique_ptr<ITranslator> translator = nullptr);
+  Transcoder(const Transcoder &other) = delete;
+  Transcoder &operator=(const Transcoder &other) = delete;
+  Transcoder(Transcoder &&other) = default;
+  Transcoder &operator=(Transcoder &&other) = default;
+  ~Transcoder() = default;
+  // Convert the source, which must hold one value and nothing after it (as
+  // for Bencode::parse), to the destination
+  ParseResultType transcode(ISource &source, IDestination &destination);
+  ParseResultType transcode(ISource &&source, IDestination &destination);
+
+private:
+  ParseResultType convert(ISource &source, IParseHandler &handler);
+
+  TranscodeFormat format;
+  BinaryEncoding binary;
+  std::unique_ptr<ITranslator> translator;
+  Event_Parser parser;
+};
+
+} // namespace Bencode_Lib
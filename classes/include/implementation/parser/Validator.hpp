@@ -0,0 +1,33 @@
+// File: Validator.hpp
+//
+// Description: Header declaring the validator that checks a Bencode document is well formed and canonical without building a Node tree.
+//
+
+#pragma once
+
+#include "Bencode.hpp"
+#include "Bencode_Core.hpp"
+
+#include <cstddef>
+
+namespace Bencode_Lib {
+
+// Applies the rules of Default_Parser (integer and string length syntax,
+// sorted unique dictionary keys, the maximum parser depth and string size)
+// plus the trailing data check of Bencode::parse, but only walks the source:
+// payloads are skipped and keys on stable sources are compared in place, so
+// nothing is allocated while validating (keys on other sources are copied
+// into small reused buffers). Failures report a specific error code and the
+// source offset at which they were found.
+class Validator {
+
+public:
+  // Frames held without allocation (deeper maximum parser depths fall back
+  // to a heap allocated frame stack)
+  constexpr static std::size_t kInlineFrames = 64;
+  // Validate the document at the source position
+  [[nodiscard]] static ParseStatus validate(ISource &source);
+  [[nodiscard]] static ParseStatus validate(ISource &&source);
+};
+
+} // namespace Bencode_Lib
@@ -0,0 +1,107 @@
+// File: Bencode_Binary_Encoding.hpp
+//
+// Description: Base64/hex output of binary strings for the JSON, XML and YAML stringifiers.
+//
+
+#pragma once
+
+#include "IDestination.hpp"
+#include "Bencode_Translator_Scan.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace Bencode_Lib {
+
+// How the JSON/XML/YAML stringifiers write strings that are binary rather
+// than text (a torrent's pieces for example): escaped like any other string
+// or encoded as base64/hex with a type marker
+enum class BinaryEncoding : std::uint8_t { Escape, Base64, Hex };
+
+// Bytes added by escaping one unprintable byte: "\u00XX" for JSON and YAML,
+// "&#x00XX;" for XML
+constexpr std::size_t kEscapeGrowth = 5;
+constexpr std::size_t kXMLEscapeGrowth = 7;
+
+// A string is written encoded when escaping it would be larger: escapes add
+// escapeGrowth bytes per unprintable byte, base64 grows the string by a
+// third and hex doubles it, and either adds a type marker
+[[nodiscard]] inline bool
+encodeAsBinary(const std::string_view text, const BinaryEncoding encoding,
+               const std::size_t escapeGrowth = kEscapeGrowth) {
+  constexpr std::size_t kMarkerSize = 16;
+  if (encoding == BinaryEncoding::Escape || text.empty()) {
+    return false;
+  }
+  const std::size_t escapedGrowth = unprintableCount(text) * escapeGrowth;
+  const std::size_t encodedGrowth =
+      encoding == BinaryEncoding::Base64
+          ? (((text.size() + 2) / 3) * 4) - text.size()
+          : text.size();
+  return escapedGrowth > encodedGrowth + kMarkerSize;
+}
+
+// Write bytes as base64 (RFC 4648, padded), a block of output at a time
+inline void addBase64(std::string_view bytes, IDestination &destination) {
+  constexpr std::string_view kAlphabet{
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"};
+  std::array<char, 1024> block;
+  std::size_t used = 0;
+  const auto byteAt = [&bytes](const std::size_t index) {
+    return static_cast<std::uint32_t>(static_cast<unsigned char>(bytes[index]));
+  };
+  for (; bytes.size() >= 3; bytes.remove_prefix(3)) {
+    const std::uint32_t group = (byteAt(0) << 16) | (byteAt(1) << 8) | byteAt(2);
+    block[used++] = kAlphabet[(group >> 18) & 0x3f];
+    block[used++] = kAlphabet[(group >> 12) & 0x3f];
+    block[used++] = kAlphabet[(group >> 6) & 0x3f];
+    block[used++] = kAlphabet[group & 0x3f];
+    if (used == block.size()) {
+      destination.add(std::string_view(block.data(), used));
+      used = 0;
+    }
+  }
+  if (!bytes.empty()) {
+    const std::uint32_t group =
+        (byteAt(0) << 16) | (bytes.size() > 1 ? byteAt(1) << 8 : 0);
+    block[used++] = kAlphabet[(group >> 18) & 0x3f];
+    block[used++] = kAlphabet[(group >> 12) & 0x3f];
+    block[used++] = bytes.size() > 1 ? kAlphabet[(group >> 6) & 0x3f] : '=';
+    block[used++] = '=';
+  }
+  if (used > 0) {
+    destination.add(std::string_view(block.data(), used));
+  }
+}
+
+// Write bytes as lower case hex, a block of output at a time
+inline void addHex(std::string_view bytes, IDestination &destination) {
+  constexpr std::string_view kDigits{"0123456789abcdef"};
+  std::array<char, 1024> block;
+  std::size_t used = 0;
+  for (const char byte : bytes) {
+    block[used++] = kDigits[(static_cast<unsigned char>(byte) >> 4) & 0x0f];
+    block[used++] = kDigits[static_cast<unsigned char>(byte) & 0x0f];
+    if (used == block.size()) {
+      destination.add(std::string_view(block.data(), used));
+      used = 0;
+    }
+  }
+  if (used > 0) {
+    destination.add(std::string_view(block.data(), used));
+  }
+}
+
+inline void addBinary(const std::string_view bytes,
+                      const BinaryEncoding encoding,
+                      IDestination &destination) {
+  if (encoding == BinaryEncoding::Hex) {
+    addHex(bytes, destination);
+  } else {
+    addBase64(bytes, destination);
+  }
+}
+
+} // namespace Bencode_Lib
@@ -8,8 +8,11 @@
 #include "Bencode.hpp"
 #include "Bencode_Core.hpp"
 
+#include <cstddef>
 #include <cstdint>
+#include <string>
 #include <string_view>
+#include <vector>
 
 namespace Bencode_Lib {
 
@@ -19,6 +22,12 @@ public:
   explicit Default_Stringify(std::unique_ptr<ITranslator> translator =
                                  std::make_unique<Default_Translator>())
       : bencodeTranslator(std::move(translator)) {}
+  // Containers parsed with source ranges (see ParseOptions) from original
+  // that have not been modified since are copied from it verbatim
+  explicit Default_Stringify(const std::string_view original,
+                             std::unique_ptr<ITranslator> translator =
+                                 std::make_unique<Default_Translator>())
+      : bencodeTranslator(std::move(translator)), original(original) {}
   Default_Stringify(const Default_Stringify &other) = delete;
   Default_Stringify &operator=(const Default_Stringify &other) = delete;
   Default_Stringify(Default_Stringify &&other) = delete;
@@ -35,26 +44,66 @@ public:
   void stringify(const Node &bNode, IDestination &destination) const override {
     stringifyNodes(bNode, destination);
   }
-
-private:
-  static void appendUnsigned(IDestination &destination,
-                             unsigned long long value) {
-    char buffer[32];
-    int writeIndex = 0;
-    if (value == 0) {
-      buffer[writeIndex++] = '0';
-    } else {
-      char temp[32];
-      int tempIndex = 0;
-      while (value > 0) {
-        temp[tempIndex++] = static_cast<char>('0' + (value % 10));
-        value /= 10;
+  // Append the encoding of a tree to a string or character vector; it is
+  // grown once to the exact encoded size so every write is a bulk copy
+  void stringify(const Node &bNode, std::string &destination) const {
+    stringifyContainer(bNode, destination);
+  }
+  void stringify(const Node &bNode, std::vector<char> &destination) const {
+    stringifyContainer(bNode, destination);
+  }
+  // Exact number of bytes stringify() writes for a tree (containers that
+  // would be copied from the original are counted at their original length)
+  [[nodiscard]] std::size_t encodedSize(const Node &bNode) const {
+    return encodedSize(bNode, original);
+  }
+  [[nodiscard]] static std::size_t encodedSize(const Node &bNode,
+                                               std::string_view original) {
+    if (isA<Dictionary>(bNode)) {
+      const auto &dictionary = NRef<Dictionary>(bNode);
+      if (const std::string_view copy =
+              originalEncoding(dictionary.sourceRange(), 'd', original);
+          !copy.empty()) {
+        return copy.size();
       }
-      while (tempIndex > 0) {
-        buffer[writeIndex++] = temp[--tempIndex];
+      std::size_t size = 2;
+      for (const auto &entry : dictionary.value()) {
+        size += stringSize(entry.getKey().length()) +
+                encodedSize(entry.getNode(), original);
       }
+      return size;
     }
-    destination.add(std::string_view(buffer, writeIndex));
+    if (isA<List>(bNode)) {
+      const auto &list = NRef<List>(bNode);
+      if (const std::string_view copy =
+              originalEncoding(list.sourceRange(), 'l', original);
+          !copy.empty()) {
+        return copy.size();
+      }
+      std::size_t size = 2;
+      for (const auto &entry : list.value()) {
+        size += encodedSize(entry, original);
+      }
+      return size;
+    }
+    if (isA<Integer>(bNode)) {
+      const Bencode::IntegerType value = NRef<Integer>(bNode).value();
+      return 2 + (value < 0 ? 1 : 0) +
+             IntegerFormat::digitCount(integerToUnsigned(value));
+    }
+    if (isA<String>(bNode)) {
+      return stringSize(NRef<String>(bNode).value().length());
+    }
+    if (isA<Hole>(bNode)) {
+      return 0;
+    }
+    throw Error("Unknown Node type encountered during encoding.");
+  }
+
+private:
+  // Length prefix, ':' and payload
+  static std::size_t stringSize(const std::size_t length) {
+    return IntegerFormat::digitCount(length) + 1 + length;
   }
 
   static unsigned long long integerToUnsigned(Bencode::IntegerType value) {
@@ -65,20 +114,46 @@ private:
   }
 
   static void appendInteger(IDestination &destination,
-                            Bencode::IntegerType value) {
-    if (value < 0) {
-      destination.add('-');
-      appendUnsigned(destination, integerToUnsigned(value));
-      return;
+                            const Bencode::IntegerType value) {
+    destination.add(IntegerFormat{value}.view());
+  }
+
+  static void appendSize(IDestination &destination, const std::size_t value) {
+    destination.add(IntegerFormat{value}.view());
+  }
+
+  // Original encoding of an unmodified container (empty if there is none;
+  // its start and end characters are checked in case the wrong original was
+  // passed)
+  [[nodiscard]] static std::string_view
+  originalEncoding(const SourceRange &range, const char start,
+                   const std::string_view original) {
+    if (range.empty() || range.end > original.size() ||
+        original[range.begin] != start || original[range.end - 1] != 'e') {
+      return {};
     }
-    appendUnsigned(destination, integerToUnsigned(value));
+    return original.substr(range.begin, range.end - range.begin);
   }
 
-  static void appendSize(IDestination &destination, std::size_t value) {
-    appendUnsigned(destination, static_cast<unsigned long long>(value));
+  // Copy an unmodified container from the original encoding
+  [[nodiscard]] bool copyOriginal(const SourceRange &range, const char start,
+                                  IDestination &destination) const {
+    const std::string_view copy = originalEncoding(range, start, original);
+    if (copy.empty()) {
+      return false;
+    }
+    destination.add(copy);
+    return true;
   }
 
-  static void stringifyNodes(const Node &bNode, IDestination &destination) {
+  template <typename Container>
+  void stringifyContainer(const Node &bNode, Container &destination) const {
+    ContainerDestination<Container> appender{destination};
+    appender.reserve(encodedSize(bNode));
+    stringifyNodes(bNode, appender);
+  }
+
+  void stringifyNodes(const Node &bNode, IDestination &destination) const {
     if (isA<Dictionary>(bNode)) {
       stringifyDictionary(bNode, destination);
     } else if (isA<List>(bNode)) {
@@ -92,18 +167,25 @@ private:
       throw Error("Unknown Node type encountered during encoding.");
     }
   }
-  static void stringifyDictionary(const Node &bNode,
-                                  IDestination &destination) {
+  void stringifyDictionary(const Node &bNode,
+                           IDestination &destination) const {
+    if (copyOriginal(NRef<Dictionary>(bNode).sourceRange(), 'd',
+                     destination)) {
+      return;
+    }
     destination.add('d');
     for (const auto &bNodeNext : NRef<Dictionary>(bNode).value()) {
       appendSize(destination, bNodeNext.getKey().length());
       destination.add(':');
-      destination.add(bNodeNext.getKey());
+      destination.reference(bNodeNext.getKey());
       stringifyNodes(bNodeNext.getNode(), destination);
     }
     destination.add('e');
   }
-  static void stringifyList(const Node &bNode, IDestination &destination) {
+  void stringifyList(const Node &bNode, IDestination &destination) const {
+    if (copyOriginal(NRef<List>(bNode).sourceRange(), 'l', destination)) {
+      return;
+    }
     destination.add('l');
     for (const auto &bNodeNext : NRef<List>(bNode).value()) {
       stringifyNodes(bNodeNext, destination);
@@ -118,9 +200,15 @@ private:
   static void stringifyString(const Node &bNode, IDestination &destination) {
     appendSize(destination, NRef<String>(bNode).value().length());
     destination.add(':');
-    destination.add(NRef<String>(bNode).value());
+    destination.reference(NRef<String>(bNode).value());
   }
 
   [[maybe_unused]] std::unique_ptr<ITranslator> bencodeTranslator;
+  std::string_view original{};
 };
+
+// Exact length of the Bencode encoding of a tree
+[[nodiscard]] inline std::size_t encodedSize(const Node &bNode) {
+  return Default_Stringify::encodedSize(bNode, {});
+}
 } // namespace Bencode_Lib
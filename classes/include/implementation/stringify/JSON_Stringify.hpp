@@ -7,6 +7,7 @@
 
 #include "Bencode.hpp"
 #include "Bencode_Core.hpp"
+#include "Bencode_Binary_Encoding.hpp"
 
 namespace Bencode_Lib {
 
@@ -15,7 +16,16 @@ public:
   // Constructors/destructors
   explicit JSON_Stringify(std::unique_ptr<ITranslator> translator =
                             std::make_unique<Default_Translator>())
-  {jsonTranslator = std::move(translator);}
+  {
+    jsonTranslator = std::move(translator);
+  }
+  // Binary strings written as {"base64" : "..."} or {"hex" : "..."}
+  explicit JSON_Stringify(const BinaryEncoding binary,
+                          std::unique_ptr<ITranslator> translator =
+                              std::make_unique<Default_Translator>())
+      : jsonBinary(binary) {
+    jsonTranslator = std::move(translator);
+  }
   JSON_Stringify(const JSON_Stringify &other) = delete;
   JSON_Stringify &operator=(const JSON_Stringify &other) = delete;
   JSON_Stringify(JSON_Stringify &&other) = delete;
@@ -29,56 +39,69 @@ public:
   /// <param name="bNode">Node structure to be traversed.</param>
   /// <param name="destination">Destination stream for stringified JSON.</param>
   void stringify(const Node &bNode, IDestination &destination) const override {
-    stringifyNodes(bNode, destination);
+    stringifyNodes(bNode, destination, jsonBinary);
   }
 
 private:
-  static void stringifyNodes(const Node &bNode, IDestination &destination)   {
+  static void stringifyNodes(const Node &bNode, IDestination &destination,
+                             const BinaryEncoding binary) {
     if (isA<Dictionary>(bNode)) {
-      stringifyDictionary(bNode, destination);
+      stringifyDictionary(bNode, destination, binary);
     } else if (isA<List>(bNode)) {
-      stringifyList(bNode, destination);
+      stringifyList(bNode, destination, binary);
     } else if (isA<Integer>(bNode)) {
       stringifyInteger(bNode, destination);
     } else if (isA<String>(bNode)) {
-      stringifyString(bNode, destination);
+      stringifyString(bNode, destination, binary);
     } else if (isA<Hole>(bNode)) {
     } else {
       throw Error("Unknown Node type encountered during encoding.");
     }
   }
-  static void stringifyDictionary(const Node &bNode, IDestination &destination)  {
+  static void stringifyDictionary(const Node &bNode, IDestination &destination,
+                                  const BinaryEncoding binary) {
     destination.add('{');
     int commas = NRef<Dictionary>(bNode).value().size();
     for (const auto &bNodeNext : NRef<Dictionary>(bNode).value()) {
       destination.add("\"");
       destination.add(bNodeNext.getKey());
       destination.add("\" : ");
-      stringifyNodes(bNodeNext.getNode(), destination);
+      stringifyNodes(bNodeNext.getNode(), destination, binary);
       if (--commas > 0)
         destination.add(",");
     }
     destination.add('}');
   }
-  static void stringifyList(const Node &bNode, IDestination &destination)  {
+  static void stringifyList(const Node &bNode, IDestination &destination,
+                            const BinaryEncoding binary) {
     int commas = NRef<List>(bNode).value().size();
     destination.add('[');
     for (const auto &bNodeNext : NRef<List>(bNode).value()) {
-      stringifyNodes(bNodeNext, destination);
+      stringifyNodes(bNodeNext, destination, binary);
       if (--commas > 0)
         destination.add(",");
     }
     destination.add(']');
   }
   static void stringifyInteger(const Node &bNode, IDestination &destination) {
-    destination.add(std::to_string(NRef<Integer>(bNode).value()));
+    destination.add(IntegerFormat{NRef<Integer>(bNode).value()}.view());
   }
-  static void stringifyString(const Node &bNode, IDestination &destination)  {
+  static void stringifyString(const Node &bNode, IDestination &destination,
+                              const BinaryEncoding binary) {
+    if (const std::string_view value = NRef<String>(bNode).value();
+        encodeAsBinary(value, binary)) {
+      destination.add(binary == BinaryEncoding::Hex ? R"({"hex" : ")"
+                                                    : R"({"base64" : ")");
+      addBinary(value, binary, destination);
+      destination.add("\"}");
+      return;
+    }
     destination.add("\"");
-    destination.add(jsonTranslator->to(NRef<String>(bNode).value()));
+    jsonTranslator->to(NRef<String>(bNode).value(), destination);
     destination.add("\"");
   }
 
   inline static std::unique_ptr<ITranslator> jsonTranslator;
+  BinaryEncoding jsonBinary{BinaryEncoding::Escape};
 };
 } // namespace Bencode_Lib
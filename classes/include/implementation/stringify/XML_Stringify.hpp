@@ -8,6 +8,7 @@
 #include "Bencode.hpp"
 #include "Bencode_Core.hpp"
 #include "XML_Translator.hpp"
+#include "Bencode_Binary_Encoding.hpp"
 
 namespace Bencode_Lib {
 
@@ -16,7 +17,16 @@ public:
   // Constructors/destructors
   explicit XML_Stringify(std::unique_ptr<ITranslator> translator =
                            std::make_unique<XML_Translator>())
-        {xmlTranslator = std::move(translator);}
+  {
+    xmlTranslator = std::move(translator);
+  }
+  // Binary strings written as <Base64>...</Base64> or <Hex>...</Hex>
+  explicit XML_Stringify(const BinaryEncoding binary,
+                         std::unique_ptr<ITranslator> translator =
+                             std::make_unique<XML_Translator>())
+      : xmlBinary(binary) {
+    xmlTranslator = std::move(translator);
+  }
   XML_Stringify(const XML_Stringify &other) = delete;
   XML_Stringify &operator=(const XML_Stringify &other) = delete;
   XML_Stringify(XML_Stringify &&other) = delete;
@@ -32,53 +42,78 @@ public:
   void stringify(const Node &bNode, IDestination &destination) const override {
     destination.add(R"(<?xml version="1.0" encoding="UTF-8"?>)");
     destination.add("<root>");
-    stringifyNodes(bNode, destination);
+    stringifyNodes(bNode, destination, xmlBinary);
     destination.add("</root>");
   }
 
+  // Element name of a key (spaces become '-') written a run at a time
+  static void addElementName(std::string_view key, IDestination &destination) {
+    for (auto space = key.find(' '); space != std::string_view::npos;
+         space = key.find(' ')) {
+      destination.add(key.substr(0, space));
+      destination.add('-');
+      key.remove_prefix(space + 1);
+    }
+    destination.add(key);
+  }
+
 private:
-  static void stringifyNodes(const Node &bNode, IDestination &destination)  {
+  static void stringifyNodes(const Node &bNode, IDestination &destination,
+                             const BinaryEncoding binary) {
     if (isA<Dictionary>(bNode)) {
-      stringifyDictionary(bNode, destination);
+      stringifyDictionary(bNode, destination, binary);
     } else if (isA<List>(bNode)) {
-      stringifyList(bNode, destination);
+      stringifyList(bNode, destination, binary);
     } else if (isA<Integer>(bNode)) {
       stringifyInteger(bNode, destination);
     } else if (isA<String>(bNode)) {
-      stringifyString(bNode, destination);
+      stringifyString(bNode, destination, binary);
     } else if (isA<Hole>(bNode)) {
     } else {
       throw Error("Unknown Node type encountered during encoding.");
     }
   }
-  static void stringifyDictionary(const Node &bNode, IDestination &destination)  {
+  static void stringifyDictionary(const Node &bNode, IDestination &destination,
+                                  const BinaryEncoding binary) {
     for (const auto &bNodeNext : NRef<Dictionary>(bNode).value()) {
-      auto elementName = std::string(bNodeNext.getKey());
-      std::ranges::replace(elementName, ' ', '-');
-      destination.add("<" + elementName + ">");
-      stringifyNodes(bNodeNext.getNode(), destination);
-      destination.add("</" + elementName + ">");
+      destination.add('<');
+      addElementName(bNodeNext.getKey(), destination);
+      destination.add('>');
+      stringifyNodes(bNodeNext.getNode(), destination, binary);
+      destination.add("</");
+      addElementName(bNodeNext.getKey(), destination);
+      destination.add('>');
     }
   }
-  static void stringifyList(const Node &bNode, IDestination &destination)  {
-    if (NRef<List>(bNode).value().size() > 1) {
-      for (const auto &bNodeNext : NRef<List>(bNode).value()) {
-        destination.add("<Row>");
-        stringifyNodes(bNodeNext, destination);
-        destination.add("</Row>");
-      }
-    } else {
+  static void stringifyList(const Node &bNode, IDestination &destination,
+                            const BinaryEncoding binary) {
+    if (NRef<List>(bNode).value().empty()) {
+      destination.add("<Row></Row>");
+      return;
+    }
+    for (const auto &bNodeNext : NRef<List>(bNode).value()) {
       destination.add("<Row>");
+      stringifyNodes(bNodeNext, destination, binary);
       destination.add("</Row>");
     }
   }
   static void stringifyInteger(const Node &bNode, IDestination &destination) {
-    destination.add(std::to_string(NRef<Integer>(bNode).value()));
+    destination.add(IntegerFormat{NRef<Integer>(bNode).value()}.view());
   }
-  static void stringifyString(const Node &bNode, IDestination &destination)  {
-    destination.add(xmlTranslator->to(NRef<String>(bNode).value()));
+  static void stringifyString(const Node &bNode, IDestination &destination,
+                              const BinaryEncoding binary) {
+    if (const std::string_view value = NRef<String>(bNode).value();
+        encodeAsBinary(value, binary, kXMLEscapeGrowth)) {
+      const bool hex = binary == BinaryEncoding::Hex;
+      destination.add(hex ? "<Hex>" : "<Base64>");
+      addBinary(value, binary, destination);
+      destination.add(hex ? "</Hex>" : "</Base64>");
+      return;
+    }
+    xmlTranslator->to(NRef<String>(bNode).value(), destination);
   }
 
   inline static std::unique_ptr<ITranslator> xmlTranslator;
+  BinaryEncoding xmlBinary{BinaryEncoding::Escape};
 };
 } // namespace Bencode_Lib
@@ -7,6 +7,7 @@
 
 #include "Bencode.hpp"
 #include "Bencode_Core.hpp"
+#include "Bencode_Binary_Encoding.hpp"
 
 namespace Bencode_Lib {
 
@@ -17,6 +18,13 @@ public:
                               std::make_unique<Default_Translator>()) {
     yamlTranslator = std::move(translator);
   }
+  // Binary strings written as !!binary "..." (base64) or !hex "..."
+  explicit YAML_Stringify(const BinaryEncoding binary,
+                          std::unique_ptr<ITranslator> translator =
+                              std::make_unique<Default_Translator>())
+      : yamlBinary(binary) {
+    yamlTranslator = std::move(translator);
+  }
   YAML_Stringify(const YAML_Stringify &other) = delete;
   YAML_Stringify &operator=(const YAML_Stringify &other) = delete;
   YAML_Stringify(YAML_Stringify &&other) = delete;
@@ -31,38 +39,47 @@ public:
   /// <param name="destination">Destination stream for stringified YAML.</param>
   void stringify(const Node &bNode, IDestination &destination) const override {
     destination.add("---\n");
-    stringifyNodes(bNode, destination, 0);
+    stringifyNodes(bNode, destination, 0, yamlBinary);
     destination.add("...\n");
   }
 
-private:
-  static auto calculateIndent(IDestination &destination,
-                              const unsigned long indent) {
-    if (destination.last() == '\n') {
-      return std::string(indent, ' ');
+  // Indent a new line from a fixed run of spaces
+  static void addIndent(IDestination &destination, unsigned long indent) {
+    constexpr std::string_view kSpaces{"                                "};
+    if (destination.last() != '\n') {
+      return;
+    }
+    for (; indent > kSpaces.size(); indent -= kSpaces.size()) {
+      destination.add(kSpaces);
+    }
+    if (indent > 0) {
+      destination.add(kSpaces.substr(0, indent));
     }
-    return std::string("");
   }
+
+private:
   static void stringifyNodes(const Node &bNode, IDestination &destination,
-                             const unsigned long indent) {
+                             const unsigned long indent,
+                             const BinaryEncoding binary) {
     if (isA<Dictionary>(bNode)) {
-      stringifyDictionary(bNode, destination, indent);
+      stringifyDictionary(bNode, destination, indent, binary);
     } else if (isA<List>(bNode)) {
-      stringifyList(bNode, destination, indent);
+      stringifyList(bNode, destination, indent, binary);
     } else if (isA<Integer>(bNode)) {
       stringifyInteger(bNode, destination);
     } else if (isA<String>(bNode)) {
-      stringifyString(bNode, destination);
+      stringifyString(bNode, destination, binary);
     } else if (isA<Hole>(bNode)) {
     } else {
       throw Error("Unknown Node type encountered during encoding.");
     }
   }
   static void stringifyDictionary(const Node &bNode, IDestination &destination,
-                                  const unsigned long indent) {
+                                  const unsigned long indent,
+                                  const BinaryEncoding binary) {
     if (!NRef<Dictionary>(bNode).value().empty()) {
       for (const auto &entryNode : NRef<Dictionary>(bNode).value()) {
-        destination.add(calculateIndent(destination, indent));
+        addIndent(destination, indent);
         destination.add("\"");
         destination.add(entryNode.getKey());
         destination.add("\"");
@@ -71,31 +88,45 @@ private:
             isA<Dictionary>(entryNode.getNode())) {
           destination.add('\n');
         }
-        stringifyNodes(entryNode.getNode(), destination, indent + 2);
+        stringifyNodes(entryNode.getNode(), destination, indent + 2, binary);
       }
     } else {
       destination.add("{}\n");
     }
   }
   static void stringifyList(const Node &bNode, IDestination &destination,
-                            const unsigned long indent) {
+                            const unsigned long indent,
+                            const BinaryEncoding binary) {
     if (!NRef<List>(bNode).value().empty()) {
       for (const auto &bNodeNext : NRef<List>(bNode).value()) {
-        destination.add(calculateIndent(destination, indent) + "- ");
-        stringifyNodes(bNodeNext, destination, indent + 2);
+        addIndent(destination, indent);
+        destination.add("- ");
+        stringifyNodes(bNodeNext, destination, indent + 2, binary);
       }
     } else {
       destination.add("[]\n");
     }
   }
   static void stringifyInteger(const Node &bNode, IDestination &destination) {
-    destination.add(std::to_string(NRef<Integer>(bNode).value()) + "\n");
+    destination.add(IntegerFormat{NRef<Integer>(bNode).value()}.view());
+    destination.add('\n');
   }
-  static void stringifyString(const Node &bNode, IDestination &destination) {
-    destination.add("\"" + yamlTranslator->to(NRef<String>(bNode).value()) +
-                    "\"" + "\n");
+  static void stringifyString(const Node &bNode, IDestination &destination,
+                              const BinaryEncoding binary) {
+    if (const std::string_view value = NRef<String>(bNode).value();
+        encodeAsBinary(value, binary)) {
+      destination.add(binary == BinaryEncoding::Hex ? "!hex \""
+                                                    : "!!binary \"");
+      addBinary(value, binary, destination);
+      destination.add("\"\n");
+      return;
+    }
+    destination.add('"');
+    yamlTranslator->to(NRef<String>(bNode).value(), destination);
+    destination.add("\"\n");
   }
 
   inline static std::unique_ptr<ITranslator> yamlTranslator;
+  BinaryEncoding yamlBinary{BinaryEncoding::Escape};
 };
 } // namespace Bencode_Lib
@@ -0,0 +1,175 @@
+// File: Bencode_Tape.hpp
+//
+// Description: Read-only flat document type that stores a parsed Bencode value on one contiguous tape of 64 bit words.
+//
+
+#pragma once
+
+#include "Bencode.hpp"
+#include "Bencode_Core.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Bencode_Lib {
+
+// Tape layout: every value starts with a word holding its type tag in the top
+// byte and a 56 bit payload, followed by one data word.
+//   integer     ['i' | 0]                   [value]
+//   string      ['s' | arena offset]        [length]
+//   list        ['l' | index past its end]  [element count]
+//   dictionary  ['d' | index past its end]  [entry count]
+//   end         ['e' | index of its start]
+// Dictionary entries are a key string followed by its value. String bytes
+// live in a single arena, so a whole document is two allocations and is
+// freed in one go.
+class BencodeTape {
+
+public:
+  // ===========
+  // Tape Error
+  // ===========
+  struct Error final : std::runtime_error {
+    explicit Error(const std::string_view &message)
+        : std::runtime_error(std::string("BencodeTape Error: ").append(message)) {
+    }
+  };
+  class Iterator;
+  // ===================================
+  // Read-only position of a tape value
+  // ===================================
+  class Cursor {
+  public:
+    Cursor(const BencodeTape &tape, const std::size_t index)
+        : tape(&tape), index(index) {}
+    // Type of value under cursor
+    [[nodiscard]] Variant::Type getNodeType() const;
+    // Value accessors (throw if the value is of a different type)
+    [[nodiscard]] Bencode::IntegerType integer() const;
+    [[nodiscard]] std::string_view string() const;
+    // Number of list elements or dictionary entries
+    [[nodiscard]] std::size_t size() const;
+    // List element at position / dictionary value with key
+    [[nodiscard]] Cursor operator[](std::size_t position) const;
+    [[nodiscard]] Cursor operator[](const std::string_view &key) const;
+    [[nodiscard]] bool contains(const std::string_view &key) const;
+    // Iterate list elements or dictionary entries
+    [[nodiscard]] Iterator begin() const;
+    [[nodiscard]] Iterator end() const;
+    // Tape word index of value
+    [[nodiscard]] std::size_t getIndex() const { return index; }
+
+  private:
+    [[nodiscard]] bool findKey(const std::string_view &key,
+                               std::size_t &valueIndex) const;
+    void checkTag(char tag, const char *message) const;
+
+    const BencodeTape *tape;
+    std::size_t index;
+  };
+  // =============================================================
+  // Iterator over list elements or dictionary entries; for the
+  // latter key() gives the entry key and * its value.
+  // =============================================================
+  class Iterator {
+  public:
+    Iterator(const BencodeTape &tape, const std::size_t index,
+             const bool dictionary)
+        : tape(&tape), index(index), dictionary(dictionary) {}
+    [[nodiscard]] Cursor operator*() const {
+      return Cursor(*tape, dictionary ? index + 2 : index);
+    }
+    [[nodiscard]] std::string_view key() const;
+    Iterator &operator++() {
+      index = tape->nextIndex(dictionary ? index + 2 : index);
+      return *this;
+    }
+    [[nodiscard]] bool operator==(const Iterator &other) const {
+      return index == other.index;
+    }
+
+  private:
+    const BencodeTape *tape;
+    std::size_t index;
+    bool dictionary;
+  };
+  using ParseResultType = Bencode::ParseResultType;
+  // Constructors/Destructors
+  BencodeTape() = default;
+  BencodeTape(const BencodeTape &other) = default;
+  BencodeTape &operator=(const BencodeTape &other) = default;
+  BencodeTape(BencodeTape &&other) = default;
+  BencodeTape &operator=(BencodeTape &&other) = default;
+  ~BencodeTape() = default;
+  // Parse Bencode onto the tape (replacing any current document)
+  ParseResultType parse(ISource &source);
+  ParseResultType parse(ISource &&source);
+  // Flatten an existing Node tree onto a tape (hole nodes are skipped)
+  [[nodiscard]] static BencodeTape fromNode(const Node &bNode);
+  // Encode the tape as Bencode (same output as Default_Stringify)
+  void stringify(IDestination &destination) const;
+  void stringify(IDestination &&destination) const;
+  // Root value cursor
+  [[nodiscard]] Cursor root() const;
+  [[nodiscard]] Cursor operator[](const std::string_view &key) const {
+    return root()[key];
+  }
+  [[nodiscard]] Cursor operator[](const std::size_t position) const {
+    return root()[position];
+  }
+  // Has a document been parsed ?
+  [[nodiscard]] bool empty() const { return tape.empty(); }
+  // Raw storage sizes (64 bit tape words / string arena bytes)
+  [[nodiscard]] std::size_t tapeSize() const { return tape.size(); }
+  [[nodiscard]] std::size_t arenaSize() const { return arena.size(); }
+
+private:
+  constexpr static int kTagShift = 56;
+  constexpr static std::uint64_t kPayloadMask = (1ull << kTagShift) - 1;
+
+  [[nodiscard]] char tag(const std::size_t index) const {
+    return static_cast<char>(tape[index] >> kTagShift);
+  }
+  [[nodiscard]] std::size_t payload(const std::size_t index) const {
+    return static_cast<std::size_t>(tape[index] & kPayloadMask);
+  }
+  // Index of the value following the one at index
+  [[nodiscard]] std::size_t nextIndex(const std::size_t index) const {
+    const char valueTag = tag(index);
+    return valueTag == 'l' || valueTag == 'd' ? payload(index) : index + 2;
+  }
+  [[nodiscard]] std::string_view stringAt(const std::size_t index) const {
+    return std::string_view(arena).substr(payload(index),
+                                          static_cast<std::size_t>(tape[index + 1]));
+  }
+  void append(char valueTag, std::uint64_t valuePayload, std::uint64_t data);
+  void appendString(const std::string_view &string);
+  std::size_t beginContainer(char valueTag);
+  void endContainer(std::size_t start, std::size_t count);
+  [[nodiscard]] bool parseIndexed(ISource &source);
+  void appendNode(const Node &bNode);
+
+  std::vector<std::uint64_t> tape;
+  std::string arena;
+};
+
+// What is tape value under cursor ?
+template <typename T> bool isA(const BencodeTape::Cursor &cursor) {
+  if constexpr (std::is_same_v<T, String>) {
+    return cursor.getNodeType() == Variant::Type::string;
+  } else if constexpr (std::is_same_v<T, Integer>) {
+    return cursor.getNodeType() == Variant::Type::integer;
+  } else if constexpr (std::is_same_v<T, List>) {
+    return cursor.getNodeType() == Variant::Type::list;
+  } else if constexpr (std::is_same_v<T, Dictionary>) {
+    return cursor.getNodeType() == Variant::Type::dictionary;
+  } else {
+    return false;
+  }
+}
+
+} // namespace Bencode_Lib
@@ -0,0 +1,100 @@
+// File: Bencode_Translator_Scan.hpp
+//
+// Description: Word at a time scan for the runs of characters translators pass through unescaped.
+//
+
+#pragma once
+
+#include "IDestination.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace Bencode_Lib {
+
+// Length of the run at the start of text holding only printable ASCII
+// (0x20-0x7E, what isprint() accepts in the "C" locale) other than the
+// Specials. Eight bytes are tested at a time (SWAR); the first word with a
+// byte needing an escape is finished a byte at a time.
+template <char... Specials>
+[[nodiscard]] inline std::size_t plainRun(const std::string_view text) {
+  constexpr std::uint64_t kOnes = 0x0101010101010101ull;
+  constexpr std::uint64_t kHighs = 0x8080808080808080ull;
+  // High bit set in (at least) the first zero byte of a word
+  constexpr auto zeroBytes = [](const std::uint64_t word) {
+    return (word - kOnes) & ~word & kHighs;
+  };
+  std::size_t index = 0;
+  for (; index + sizeof(std::uint64_t) <= text.size();
+       index += sizeof(std::uint64_t)) {
+    std::uint64_t word;
+    std::memcpy(&word, text.data() + index, sizeof(word));
+    // Below 0x20, 0x80 and above or 0x7F (DEL)
+    std::uint64_t escapes = ((word - kOnes * 0x20) & ~word & kHighs) |
+                            (word & kHighs) | zeroBytes(word ^ (kOnes * 0x7F));
+    ((escapes |= zeroBytes(word ^ (kOnes * static_cast<unsigned char>(
+                                               Specials)))),
+     ...);
+    if (escapes != 0) {
+      break;
+    }
+  }
+  for (; index < text.size(); ++index) {
+    const auto ch = static_cast<unsigned char>(text[index]);
+    if (ch < 0x20 || ch > 0x7E ||
+        ((ch == static_cast<unsigned char>(Specials)) || ...)) {
+      break;
+    }
+  }
+  return index;
+}
+
+// Number of bytes in text outside printable ASCII (0x20-0x7E), counted
+// exactly eight bytes at a time (SWAR)
+[[nodiscard]] inline std::size_t unprintableCount(const std::string_view text) {
+  constexpr std::uint64_t kOnes = 0x0101010101010101ull;
+  constexpr std::uint64_t kHighs = 0x8080808080808080ull;
+  constexpr std::uint64_t kLows = 0x7F7F7F7F7F7F7F7Full;
+  std::size_t count = 0;
+  std::size_t index = 0;
+  for (; index + sizeof(std::uint64_t) <= text.size();
+       index += sizeof(std::uint64_t)) {
+    std::uint64_t word;
+    std::memcpy(&word, text.data() + index, sizeof(word));
+    // Per byte flags with no carries between bytes: high bit set, low seven
+    // bits below 0x20, or 0x7F
+    const std::uint64_t lows = word & kLows;
+    const std::uint64_t flags = (word | ~(lows + kOnes * 0x60) |
+                                 ((lows + kOnes) & ~word)) &
+                                kHighs;
+    count += static_cast<std::size_t>(std::popcount(flags));
+  }
+  for (; index < text.size(); ++index) {
+    const auto ch = static_cast<unsigned char>(text[index]);
+    count += ch < 0x20 || ch > 0x7E ? 1 : 0;
+  }
+  return count;
+}
+
+// Write text to a destination, passing plain runs through in bulk and
+// handing every other character to escape(ch, destination)
+template <char... Specials, typename Escape>
+inline void translateRuns(std::string_view text, IDestination &destination,
+                          const Escape &escape) {
+  while (!text.empty()) {
+    const std::size_t run = plainRun<Specials...>(text);
+    if (run > 0) {
+      destination.add(text.substr(0, run));
+    }
+    if (run == text.size()) {
+      return;
+    }
+    escape(text[run], destination);
+    text.remove_prefix(run + 1);
+  }
+}
+
+} // namespace Bencode_Lib
@@ -6,6 +6,8 @@
 #pragma once
 
 #include "ITranslator.hpp"
+#include "Bencode_ContainerDestination.hpp"
+#include "Bencode_Translator_Scan.hpp"
 
 namespace Bencode_Lib {
 
@@ -19,18 +21,21 @@ public:
   }
   [[nodiscard]] std::string to( const std::string_view &escapedString) const override {
     std::string translated;
-    for (const char ch : escapedString) {
-      if (!isprint(ch)) {
-        const auto digits = "0123456789ABCDEF";
-        translated += "\\u00";
-        translated += digits[ch >> 4 & 0x0f];
-        translated += digits[ch&0x0f];
-      } else {
-        translated += ch;
-      }
-    }
+    ContainerDestination<std::string> destination{translated};
+    to(escapedString, destination);
     return translated;
   }
+  void to(const std::string_view &escapedString,
+          IDestination &destination) const override {
+    translateRuns<>(escapedString, destination,
+                    [](const char ch, IDestination &escaped) {
+                      const auto digits = "0123456789ABCDEF";
+                      const char sequence[]{'\\', 'u', '0', '0',
+                                            digits[ch >> 4 & 0x0f],
+                                            digits[ch & 0x0f]};
+                      escaped.add(std::string_view(sequence, sizeof(sequence)));
+                    });
+  }
 };
 
-} // namespace Bencode_Lib
\ No newline at end of file
+} // namespace Bencode_Lib
@@ -6,6 +6,8 @@
 #pragma once
 
 #include "ITranslator.hpp"
+#include "Bencode_ContainerDestination.hpp"
+#include "Bencode_Translator_Scan.hpp"
 
 namespace Bencode_Lib {
 
@@ -19,30 +21,32 @@ public:
   }
   [[nodiscard]] std::string to(const std::string_view &escapedString) const override {
     std::string translated;
-    for (const  char ch : escapedString) {
-      if (!isprint(ch)) {
-        translated += "&#x00";
-        const auto digits = "0123456789ABCDEF";
-        translated += digits[ch >> 4 & 0x0f];
-        translated += digits[ch&0x0f];
-        translated += ";";
-      } else {
-        if (ch == '&') {
-          translated += "&amp;";
-        } else if (ch == '<') {
-          translated += "&lt;";
-        } else if (ch == '>') {
-          translated += "&gt;";
-        } else if (ch == '\'') {
-          translated += "&apos;";
-        } else if (ch == '"') {
-          translated += "&quot;";
-        } else {
-          translated += ch;
-        }
-      }
-    }
+    ContainerDestination<std::string> destination{translated};
+    to(escapedString, destination);
     return translated;
   }
+  void to(const std::string_view &escapedString,
+          IDestination &destination) const override {
+    translateRuns<'&', '<', '>', '\'', '"'>(
+        escapedString, destination, [](const char ch, IDestination &escaped) {
+          if (ch == '&') {
+            escaped.add("&amp;");
+          } else if (ch == '<') {
+            escaped.add("&lt;");
+          } else if (ch == '>') {
+            escaped.add("&gt;");
+          } else if (ch == '\'') {
+            escaped.add("&apos;");
+          } else if (ch == '"') {
+            escaped.add("&quot;");
+          } else {
+            const auto digits = "0123456789ABCDEF";
+            const char reference[]{'&', '#', 'x', '0', '0',
+                                   digits[ch >> 4 & 0x0f],
+                                   digits[ch & 0x0f], ';'};
+            escaped.add(std::string_view(reference, sizeof(reference)));
+          }
+        });
+  }
 };
-} // namespace Bencode_Lib
\ No newline at end of file
+} // namespace Bencode_Lib
@@ -8,6 +8,7 @@
 #include "Bencode_FixedVector.hpp"
 
 #include <algorithm>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 #if BENCODE_ENABLE_DYNAMIC_ALLOCATION
@@ -21,14 +22,24 @@ struct DictionaryEntry {
   DictionaryEntry() = default;
 
   template <typename Key>
-  DictionaryEntry(Key &&key, Node &&bNode)
-      : key(std::forward<Key>(key)), bNode(std::move(bNode)) {}
-
-  [[nodiscard]] std::string_view getKey() const { return key; }
+  DictionaryEntry(const Key &key, Node &&bNode)
+      : key(std::string_view(key)), bNode(std::move(bNode)) {}
+  DictionaryEntry(std::string &&key, Node &&bNode)
+      : key(std::move(key)), bNode(std::move(bNode)) {}
+  DictionaryEntry(const std::string_view key, Node &&bNode, Borrowed)
+      : key(key, Borrowed{}), bNode(std::move(bNode)) {}
+
+  [[nodiscard]] std::string_view getKey() const { return key.value(); }
   [[nodiscard]] Node &getNode() { return bNode; }
   [[nodiscard]] const Node &getNode() const { return bNode; }
 
-  std::string key;
+  // Does the key still view borrowed memory ?
+  [[nodiscard]] bool isBorrowed() const noexcept { return key.isBorrowed(); }
+  // Copy a borrowed key into owned storage
+  void promote() { key.promote(); }
+
+  // Stored like a string value (heap, arena or borrowed)
+  String key;
   Node bNode{};
 };
 
@@ -36,33 +47,39 @@ struct DictionaryEntry {
 struct Dictionary : Variant {
   using Entry = DictionaryEntry;
 #if BENCODE_ENABLE_DYNAMIC_ALLOCATION
-  using Entries = std::vector<Entry>;
+  using Entries = std::pmr::vector<Entry>;
 #else
   using Entries = FixedVector<Entry, BENCODE_MAX_CONTAINER_SIZE>;
 #endif
   // Constructors/Destructors
+#if BENCODE_ENABLE_DYNAMIC_ALLOCATION
+  Dictionary() : Variant(Type::dictionary), bNodeDictionary(nodeResource()) {}
+#else
   Dictionary() : Variant(Type::dictionary) {}
+#endif
   Dictionary(Dictionary &&other) = default;
   Dictionary &operator=(Dictionary &&other) = default;
   ~Dictionary() = default;
   // Add Entry to Dictionary
   template <typename T> void add(T &&entry) {
-    const auto &key = entry.key;
+    range = {};
+    const std::string_view key = entry.getKey();
     auto it =
         std::lower_bound(bNodeDictionary.begin(), bNodeDictionary.end(), key,
                          [](const Entry &lhs, const std::string_view rhsKey) {
-                           return std::string_view(lhs.key) < rhsKey;
+                           return lhs.getKey() < rhsKey;
                          });
-    if (it != bNodeDictionary.end() && it->key == key) {
+    if (it != bNodeDictionary.end() && it->getKey() == key) {
       throw Node::Error("Duplicate dictionary key.");
     }
     bNodeDictionary.insert(it, std::forward<T>(entry));
   }
 
   template <typename T> void appendSorted(T &&entry) {
-    const auto &key = entry.key;
+    range = {};
+    const std::string_view key = entry.getKey();
     if (!bNodeDictionary.empty()) {
-      const auto &previousKey = bNodeDictionary.back().key;
+      const std::string_view previousKey = bNodeDictionary.back().getKey();
       if (previousKey == key) {
         throw Node::Error("Duplicate dictionary key.");
       }
@@ -77,33 +94,42 @@ struct Dictionary : Variant {
     auto it =
         std::lower_bound(bNodeDictionary.begin(), bNodeDictionary.end(), key,
                          [](const Entry &lhs, const std::string_view rhsKey) {
-                           return std::string_view(lhs.key) < rhsKey;
+                           return lhs.getKey() < rhsKey;
                          });
-    return it != bNodeDictionary.end() && it->key == key;
+    return it != bNodeDictionary.end() && it->getKey() == key;
   }
   [[nodiscard]] int size() const {
     return static_cast<int>(bNodeDictionary.size());
   }
 
   Node &operator[](const std::string_view key) {
+    range = {};
     return findEntryWithKey(bNodeDictionary, key)->bNode;
   }
   const Node &operator[](const std::string_view key) const {
     return findEntryWithKey(bNodeDictionary, key)->bNode;
   }
 
-  [[nodiscard]] Entries &value() { return bNodeDictionary; }
+  [[nodiscard]] Entries &value() {
+    range = {};
+    return bNodeDictionary;
+  }
   [[nodiscard]] const Entries &value() const { return bNodeDictionary; }
 
+  // Source bytes the dictionary was parsed from (cleared by any non-const
+  // access as its contents may then change)
+  [[nodiscard]] const SourceRange &sourceRange() const { return range; }
+  void setSourceRange(const SourceRange &sourceRange) { range = sourceRange; }
+
 private:
   template <typename T>
   static auto findEntry(T &dictionary, const std::string_view &key) {
     auto it =
         std::lower_bound(dictionary.begin(), dictionary.end(), key,
                          [](const Entry &lhs, const std::string_view rhsKey) {
-                           return std::string_view(lhs.key) < rhsKey;
+                           return lhs.getKey() < rhsKey;
                          });
-    if (it == dictionary.end() || it->key != key) {
+    if (it == dictionary.end() || it->getKey() != key) {
       throw Node::Error("Invalid key used in dictionary.");
     }
     return it;
@@ -120,6 +146,7 @@ private:
   }
 
   Entries bNodeDictionary{};
+  SourceRange range{};
 };
 
 } // namespace Bencode_Lib
\ No newline at end of file
@@ -7,6 +7,7 @@
 
 #include "Bencode_FixedVector.hpp"
 #if BENCODE_ENABLE_DYNAMIC_ALLOCATION
+#include <memory_resource>
 #include <vector>
 #endif
 
@@ -15,25 +16,36 @@ namespace Bencode_Lib {
 struct List : Variant {
   using Entry = Node;
 #if BENCODE_ENABLE_DYNAMIC_ALLOCATION
-  using ListEntries = std::vector<Entry>;
+  using ListEntries = std::pmr::vector<Entry>;
 #else
   using ListEntries = FixedVector<Entry, BENCODE_MAX_CONTAINER_SIZE>;
 #endif
   // Constructors/Destructors
+#if BENCODE_ENABLE_DYNAMIC_ALLOCATION
+  List() : Variant(Type::list), bNodeList(nodeResource()) {}
+#else
   List() : Variant(Type::list) {}
+#endif
   List(List &&other) = default;
   List &operator=(List &&other) = default;
   ~List() = default;
   // Add array element
-  void add(Entry bNode) { bNodeList.emplace_back(std::move(bNode)); }
+  void add(Entry bNode) {
+    range = {};
+    bNodeList.emplace_back(std::move(bNode));
+  }
   // Get Node size
   [[nodiscard]] int size() const { return static_cast<int>(bNodeList.size()); }
   // Get Node value
-  [[nodiscard]] ListEntries &value() { return bNodeList; }
+  [[nodiscard]] ListEntries &value() {
+    range = {};
+    return bNodeList;
+  }
   [[nodiscard]] const ListEntries &value() const { return bNodeList; }
   // Get Node at index
   Node &operator[](const int index) {
     validateIndex(index);
+    range = {};
     return bNodeList[index];
   }
   const Node &operator[](const int index) const {
@@ -42,6 +54,7 @@ struct List : Variant {
   }
   // Resize Array
   void resize(const std::size_t index) {
+    range = {};
     bNodeList.resize(index + 1);
     for (auto &entry : bNodeList) {
       if (entry.isEmpty()) {
@@ -50,6 +63,11 @@ struct List : Variant {
     }
   }
 
+  // Source bytes the list was parsed from (cleared by any non-const access
+  // as its contents may then change)
+  [[nodiscard]] const SourceRange &sourceRange() const { return range; }
+  void setSourceRange(const SourceRange &sourceRange) { range = sourceRange; }
+
 private:
   // ensure the index is within the bounds
   void validateIndex(const int index) const {
@@ -59,5 +77,6 @@ private:
   }
 
   ListEntries bNodeList{};
+  SourceRange range{};
 };
 } // namespace Bencode_Lib
\ No newline at end of file
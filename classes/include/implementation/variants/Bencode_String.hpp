@@ -6,11 +6,21 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <new>
 #include <string>
 #include <string_view>
 
 namespace Bencode_Lib {
 
+// Tag selecting a String or dictionary key that borrows (views) its bytes
+// from memory the caller keeps pinned, such as the parse source buffer
+struct Borrowed {
+  explicit Borrowed() = default;
+};
+
 struct String : Variant {
 #if defined(BENCODE_MAX_STRING_LENGTH)
   constexpr static std::uint64_t kMaxLength = BENCODE_MAX_STRING_LENGTH;
@@ -19,37 +29,116 @@ struct String : Variant {
 #endif
 
   // Constructors/Destructors
-  String() : Variant(Type::string), mValue() {}
-  explicit String(const std::string_view string)
-      : Variant(Type::string), mValue(string.data(), string.size()) {}
-  explicit String(const char *string) : Variant(Type::string), mValue(string) {}
-  explicit String(std::string &&string)
-      : Variant(Type::string), mValue(std::move(string)) {}
-  explicit String(std::size_t length)
-      : Variant(Type::string), mValue(length, '\0') {}
-
-  String(const String &other) = default;
-  String(String &&other) noexcept = default;
-  String &operator=(const String &other) = default;
-  String &operator=(String &&other) noexcept = default;
-  ~String() = default;
+  String() : Variant(Type::string), mOwned() {}
+  explicit String(const std::string_view string) : Variant(Type::string) {
+    construct(string.data(), string.size());
+  }
+  explicit String(const char *string) : String(std::string_view(string)) {}
+  // Moved in without a copy unless an arena is active on the thread
+  explicit String(std::string &&string) : Variant(Type::string) {
+    if (Bencode_Arena::current() != nullptr) {
+      construct(string.data(), string.size());
+    } else {
+      new (&mOwned) std::string(std::move(string));
+    }
+  }
+  explicit String(const std::size_t length) : Variant(Type::string) {
+    if (char *bytes = arenaAllocate(length); bytes != nullptr) {
+      std::memset(bytes, 0, length);
+      constructView(Storage::arena, std::string_view(bytes, length));
+    } else {
+      new (&mOwned) std::string(length, '\0');
+    }
+  }
+  String(const std::string_view string, Borrowed) : Variant(Type::string) {
+    constructView(Storage::borrowed, string);
+  }
+
+  String(const String &other) : Variant(other) {
+    if (other.isBorrowed()) {
+      constructView(Storage::borrowed, other.mView);
+    } else {
+      construct(other.value().data(), other.value().size());
+    }
+  }
+  String(String &&other) noexcept : Variant(other) {
+    constructFrom(std::move(other));
+  }
+  String &operator=(const String &other) {
+    if (this != &other) {
+      String copy{other};
+      *this = std::move(copy);
+    }
+    return *this;
+  }
+  String &operator=(String &&other) noexcept {
+    if (this == &other) {
+      return *this;
+    }
+    if (mStorage == Storage::owned && other.mStorage == Storage::owned) {
+      mOwned = std::move(other.mOwned);
+    } else {
+      destroy();
+      constructFrom(std::move(other));
+    }
+    return *this;
+  }
+  ~String() { destroy(); }
 
   // Get Node value
   [[nodiscard]] std::string_view value() const noexcept {
-    return std::string_view(mValue.data(), mValue.size());
+    return mStorage == Storage::owned
+               ? std::string_view(mOwned.data(), mOwned.size())
+               : mView;
   }
 
-  [[nodiscard]] char *data() noexcept { return mValue.data(); }
-  [[nodiscard]] const char *data() const noexcept { return mValue.data(); }
+  // Writable access promotes a borrowed value first
+  [[nodiscard]] char *data() {
+    promote();
+    // Arena bytes belong to the document so may be written in place
+    return mStorage == Storage::arena ? const_cast<char *>(mView.data())
+                                      : mOwned.data();
+  }
+  [[nodiscard]] const char *data() const noexcept { return value().data(); }
 
-  void resize(std::size_t newSize) { mValue.resize(newSize); }
+  void resize(const std::size_t newSize) {
+    promote();
+    if (mStorage == Storage::owned) {
+      mOwned.resize(newSize);
+    } else if (newSize <= mView.size()) {
+      mView = mView.substr(0, newSize);
+    } else {
+      String resized{newSize};
+      std::memcpy(resized.data(), mView.data(), mView.size());
+      *this = std::move(resized);
+    }
+  }
 
   void assign(const std::string_view string) {
-    mValue.assign(string.data(), string.size());
+    assign(string.data(), string.size());
   }
 
   void assign(const char *data, const std::size_t length) {
-    mValue.assign(data, length);
+    if (mStorage == Storage::owned && Bencode_Arena::current() == nullptr) {
+      mOwned.assign(data, length);
+    } else {
+      *this = String(std::string_view(data, length));
+    }
+  }
+
+  // Does the value still view borrowed memory ?
+  [[nodiscard]] bool isBorrowed() const noexcept {
+    return mStorage == Storage::borrowed;
+  }
+  // Is the value stored in an arena rather than on the heap ?
+  [[nodiscard]] bool isArena() const noexcept {
+    return mStorage == Storage::arena;
+  }
+  // Copy a borrowed value into owned storage (the active arena if any)
+  void promote() {
+    if (isBorrowed()) {
+      *this = String(mView);
+    }
   }
 
   // Set/get maximum string length
@@ -59,7 +148,53 @@ struct String : Variant {
   static uint64_t getMaxStringLength() { return maxStringLength; }
 
 private:
-  std::string mValue;
+  // Heap strings are a plain std::string; strings in an arena or borrowed
+  // from the source are a view of bytes that are never freed individually
+  enum class Storage : std::uint8_t { owned, arena, borrowed };
+
+  // Bytes for a string in the thread's arena (nullptr if none is active or
+  // the string is empty)
+  [[nodiscard]] static char *arenaAllocate(const std::size_t length) {
+    std::pmr::memory_resource *arena = Bencode_Arena::current();
+    if (arena == nullptr || length == 0) {
+      return nullptr;
+    }
+    return static_cast<char *>(arena->allocate(length, 1));
+  }
+  // The constructors start with no union member active
+  void construct(const char *bytes, const std::size_t length) {
+    if (char *copy = arenaAllocate(length); copy != nullptr) {
+      std::memcpy(copy, bytes, length);
+      constructView(Storage::arena, std::string_view(copy, length));
+    } else {
+      new (&mOwned) std::string(bytes, length);
+    }
+  }
+  void constructView(const Storage storage,
+                     const std::string_view view) noexcept {
+    new (&mView) std::string_view(view);
+    mStorage = storage;
+  }
+  void constructFrom(String &&other) noexcept {
+    if (other.mStorage == Storage::owned) {
+      new (&mOwned) std::string(std::move(other.mOwned));
+      mStorage = Storage::owned;
+    } else {
+      constructView(other.mStorage, other.mView);
+    }
+  }
+  void destroy() noexcept {
+    if (mStorage == Storage::owned) {
+      std::destroy_at(&mOwned);
+    }
+  }
+
+  // Declared first so that it shares the word holding the variant type
+  Storage mStorage = Storage::owned;
+  union {
+    std::string mOwned;
+    std::string_view mView;
+  };
   inline static uint64_t maxStringLength{kMaxLength};
 };
 
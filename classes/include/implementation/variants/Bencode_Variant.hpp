@@ -7,6 +7,13 @@
 
 namespace Bencode_Lib {
 
+// Offsets [begin, end) of the encoded bytes a value was parsed from
+struct SourceRange {
+  std::size_t begin = 0;
+  std::size_t end = 0;
+  [[nodiscard]] bool empty() const { return end == begin; }
+};
+
 struct Variant {
   enum class Type : std::uint8_t { base = 0, dictionary, list, integer, string, hole };
   // Constructors/Destructors
@@ -10,4 +10,5 @@
 #include "IDestination.hpp"
 #include "IStringify.hpp"
 #include "IParser.hpp"
+#include "IParseHandler.hpp"
 #include "ITranslator.hpp"
\ No newline at end of file
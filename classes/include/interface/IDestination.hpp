@@ -38,6 +38,12 @@ public:
   // Add character to destination
   // ============================
   virtual void add(char ch) = 0;
+  // ==================================================================
+  // Add bytes the caller keeps valid and unchanged until the output is
+  // flushed (such as node payloads), which a destination may reference
+  // in place rather than copy. Plain add() never makes that promise.
+  // ==================================================================
+  virtual void reference(const std::string_view &bytes) { add(bytes); }
   // ==============================
   // Clear the current destination
   // ==============================
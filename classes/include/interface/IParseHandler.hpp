@@ -0,0 +1,56 @@
+// File: IParseHandler.hpp
+//
+// Description: Interface for event callbacks driven directly from the source while parsing, without building a Node tree.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace Bencode_Lib {
+
+// ===============================================================
+// Interface for the events raised while parsing Bencode in order;
+// string and key views are only valid for the duration of the call
+// ===============================================================
+class IParseHandler {
+public:
+  // ===================
+  // IParseHandler Error
+  // ===================
+  struct Error final : std::runtime_error {
+    explicit Error(const std::string_view &message)
+        : std::runtime_error(
+              std::string("IParseHandler Error: ").append(message)) {}
+  };
+  // ========================
+  // Constructors/destructors
+  // ========================
+  virtual ~IParseHandler() = default;
+  // ===============================
+  // Integer encountered so process
+  // ===============================
+  virtual void onInteger([[maybe_unused]] std::int64_t value) {}
+  // ==============================
+  // String encountered so process
+  // ==============================
+  virtual void onString([[maybe_unused]] std::string_view value) {}
+  // ===============================
+  // List started/finished so process
+  // ===============================
+  virtual void onListBegin() {}
+  virtual void onListEnd() {}
+  // =====================================
+  // Dictionary started/finished so process
+  // =====================================
+  virtual void onDictionaryBegin() {}
+  virtual void onDictionaryEnd() {}
+  // ==========================================================
+  // Dictionary key encountered (its value's events follow) so process
+  // ==========================================================
+  virtual void onKey([[maybe_unused]] std::string_view key) {}
+};
+} // namespace Bencode_Lib
@@ -63,4 +63,9 @@ protected:
   virtual ParseStatus parseImpl(ISource &source, Node &destination) = 0;
 #endif
 };
+// Make custom parser
+// to pass to Bencode constructor:The parser pointer is tidied up internally.
+template <typename T, typename... Args> IParser *makeParser(Args &&...args) {
+  return std::make_unique<T>(std::forward<Args>(args)...).release();
+}
 } // namespace Bencode_Lib
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <stdexcept>
 #include <string_view>
 
@@ -42,5 +43,48 @@ public:
   // Reset to beginning of source stream
   // ===================================
   [[maybe_unused]] virtual void reset() = 0;
+  // ====================================================================
+  // Return a view of the next count characters (fewer at end of source)
+  // without consuming them. An empty view means the source has no
+  // contiguous storage and callers must fall back to current()/next().
+  // ====================================================================
+  [[nodiscard]] virtual std::string_view peek(
+      [[maybe_unused]] std::size_t count) const {
+    return {};
+  }
+  // ===============================================================
+  // Offset of the current character from the start of the source
+  // (npos if the source does not track it)
+  // ===============================================================
+  static constexpr std::size_t npos = std::string_view::npos;
+  [[nodiscard]] virtual std::size_t position() const { return npos; }
+  // =================================================================
+  // Do views returned by peek() stay valid after the source has moved
+  // past them (for as long as its underlying buffer is kept) ?
+  // =================================================================
+  [[nodiscard]] virtual bool stable() const { return false; }
+  // ==============================================================
+  // Is all of the remaining input already in memory, so that peek()
+  // returns it without reading (or buffering) any more ?
+  // ==============================================================
+  [[nodiscard]] virtual bool contiguous() const { return false; }
+  // ====================================================
+  // Copy the next count characters into buffer and move
+  // past them
+  // ====================================================
+  virtual void read(char *buffer, const std::size_t count) {
+    for (std::size_t index = 0; index < count; ++index) {
+      buffer[index] = current();
+      next();
+    }
+  }
+  // ===================================
+  // Move past the next count characters
+  // ===================================
+  virtual void skip(const std::size_t count) {
+    for (std::size_t index = 0; index < count; ++index) {
+      next();
+    }
+  }
 };
 } // namespace Bencode_Lib
\ No newline at end of file
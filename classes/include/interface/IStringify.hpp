@@ -36,7 +36,8 @@ public:
 };
 // Make custom stringify
 // to pass to Bencode constructor:The note pointer is tidied up internally.
-template <typename T> IStringify *makeStringify() {
-  return std::make_unique<T>().release();
+template <typename T, typename... Args>
+IStringify *makeStringify(Args &&...args) {
+  return std::make_unique<T>(std::forward<Args>(args)...).release();
 }
 } // namespace Bencode_Lib
\ No newline at end of file
@@ -5,6 +5,12 @@
 
 #pragma once
 
+#include "IDestination.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
 namespace Bencode_Lib {
 
 // ====================================================
@@ -34,5 +40,12 @@ public:
   // escapes where applicable for its form.
   // =========================================================================
   [[nodiscard]] virtual std::string to(const std::string_view &rawString) const = 0;
+  // =========================================================================
+  // Write the escaped form of a string straight to a destination (translators
+  // that only implement the string form are adapted here).
+  // =========================================================================
+  virtual void to(const std::string_view &rawString, IDestination &destination) const {
+    destination.add(to(rawString));
+  }
 };
 }// namespace Bencode_Lib
@@ -23,6 +23,14 @@ namespace Bencode_Lib {
 Bencode::Bencode([[maybe_unused]] IStringify *stringify,
                  [[maybe_unused]] IParser *parser)
     : implementation(std::make_unique<Bencode_Impl>(stringify, parser)) {}
+/// <summary>
+/// Initialise the implementation layer with a document arena that serves
+/// the Node tree memory.
+/// </summary>
+Bencode::Bencode(const ArenaOptions &arena, [[maybe_unused]] IStringify *stringify,
+                 [[maybe_unused]] IParser *parser)
+    : implementation(
+          std::make_unique<Bencode_Impl>(stringify, parser, &arena)) {}
 Bencode::~Bencode() = default;
 /// <summary>
 /// Bencode constructor. Pass a Bencode string to be initially parsed.
@@ -62,6 +70,19 @@ Bencode::ParseResultType Bencode::parse(ISource &&source) const {
   return implementation->parse(std::move(source));
 }
 /// <summary>
+/// Check that the Bencode pointed to by source stream is well formed without
+/// building a Node tree.
+/// </summary>
+/// <param name="source">Reference to input interface used to parse Bencoded
+/// stream.</param> <returns>Status with error code and offset.</returns>
+ParseStatus Bencode::validate(ISource &source) {
+  return Validator::validate(source);
+}
+
+ParseStatus Bencode::validate(ISource &&source) {
+  return Validator::validate(source);
+}
+/// <summary>
 /// Take Node structure and create a Bencode encoding for it in the
 /// destination stream.
 /// </summary>
@@ -87,6 +108,12 @@ void Bencode::traverse(IAction &action) const {
   std::as_const(*implementation).traverse(action);
 }
 /// <summary>
+/// Copy any string values and dictionary keys that borrow the source buffer
+/// (StringStorage::Borrowed parsing) into owned storage so that the buffer
+/// can be released.
+/// </summary>
+void Bencode::promote() { implementation->promote(); }
+/// <summary>
 /// Get the root of Node tree.
 /// </summary>
 /// <returns>Root of Node encoded tree.</returns>
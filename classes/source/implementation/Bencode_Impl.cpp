@@ -12,7 +12,11 @@ namespace Bencode_Lib {
 
 // Need size information for destructor to clean up unique_ptr to
 // stringify/parser.
-Bencode_Impl::Bencode_Impl(IStringify *stringify, IParser *parser) {
+Bencode_Impl::Bencode_Impl(IStringify *stringify, IParser *parser,
+                           const ArenaOptions *arenaOptions) {
+  if (arenaOptions != nullptr) {
+    arena = std::make_unique<Bencode_Arena>(*arenaOptions);
+  }
   if (stringify == nullptr) {
     bNodeStringify = std::make_unique<Default_Stringify>();
   } else {
@@ -49,6 +53,12 @@ Bencode_Impl::ParseResultType Bencode_Impl::parse(ISource &&source) {
 }
 
 Bencode_Impl::ParseResultType Bencode_Impl::parseImpl(ISource &source) {
+  if (arena != nullptr) {
+    // Reuse the arena for the new tree
+    bNodeRoot = Node{};
+    arena->release();
+  }
+  const Bencode_Arena::Scope scope{arena.get()};
 #if BENCODE_ENABLE_EXCEPTIONS
   bNodeRoot = bNodeParser->parse(source);
   return handleParseResult(source);
@@ -121,6 +131,14 @@ void Bencode_Impl::traverse(IAction &action) const {
   traverseImpl(action);
 }
 
+void Bencode_Impl::promote() {
+  // Promoted strings are copied into the document's arena if it has one
+  const Bencode_Arena::Scope scope{arena.get()};
+  if (!bNodeRoot.isEmpty()) {
+    Bencode_Lib::promote(bNodeRoot);
+  }
+}
+
 Node &Bencode_Impl::operator[](const std::string_view &key) {
   return getOrCreateDictionaryEntry(key);
 }
@@ -147,6 +165,7 @@ Node &Bencode_Impl::getOrCreateListEntry(std::size_t index) {
 
 template <typename Container>
 Node &Bencode_Impl::ensureRoot() {
+  const Bencode_Arena::Scope scope{arena.get()};
   if (bNodeRoot.isEmpty()) {
     bNodeRoot = Node::make<Container>();
   }
@@ -155,6 +174,7 @@ Node &Bencode_Impl::ensureRoot() {
 
 template <typename Container, typename Key>
 Node &Bencode_Impl::getOrCreateRootEntry(Key &&key) {
+  const Bencode_Arena::Scope scope{arena.get()};
   try {
     return ensureRoot<Container>()[std::forward<Key>(key)];
   } catch ([[maybe_unused]] Node::Error &error) {
@@ -0,0 +1,233 @@
+// File: Bencode_Hash.cpp
+//
+// Description: Source implementation of the incremental SHA-1/SHA-256 hasher.
+//
+
+#include "Bencode_Hash.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace Bencode_Lib {
+
+namespace {
+
+constexpr std::array<std::uint32_t, 5> kSHA1Initial{
+    0x67452301u, 0xEFCDAB89u, 0x98BADCFEu, 0x10325476u, 0xC3D2E1F0u};
+
+constexpr std::array<std::uint32_t, 8> kSHA256Initial{
+    0x6a09e667u, 0xbb67ae85u, 0x3c6ef372u, 0xa54ff53au,
+    0x510e527fu, 0x9b05688cu, 0x1f83d9abu, 0x5be0cd19u};
+
+constexpr std::array<std::uint32_t, 64> kSHA256Rounds{
+    0x428a2f98u, 0x71374491u, 0xb5c0fbcfu, 0xe9b5dba5u, 0x3956c25bu,
+    0x59f111f1u, 0x923f82a4u, 0xab1c5ed5u, 0xd807aa98u, 0x12835b01u,
+    0x243185beu, 0x550c7dc3u, 0x72be5d74u, 0x80deb1feu, 0x9bdc06a7u,
+    0xc19bf174u, 0xe49b69c1u, 0xefbe4786u, 0x0fc19dc6u, 0x240ca1ccu,
+    0x2de92c6fu, 0x4a7484aau, 0x5cb0a9dcu, 0x76f988dau, 0x983e5152u,
+    0xa831c66du, 0xb00327c8u, 0xbf597fc7u, 0xc6e00bf3u, 0xd5a79147u,
+    0x06ca6351u, 0x14292967u, 0x27b70a85u, 0x2e1b2138u, 0x4d2c6dfcu,
+    0x53380d13u, 0x650a7354u, 0x766a0abbu, 0x81c2c92eu, 0x92722c85u,
+    0xa2bfe8a1u, 0xa81a664bu, 0xc24b8b70u, 0xc76c51a3u, 0xd192e819u,
+    0xd6990624u, 0xf40e3585u, 0x106aa070u, 0x19a4c116u, 0x1e376c08u,
+    0x2748774cu, 0x34b0bcb5u, 0x391c0cb3u, 0x4ed8aa4au, 0x5b9cca4fu,
+    0x682e6ff3u, 0x748f82eeu, 0x78a5636fu, 0x84c87814u, 0x8cc70208u,
+    0x90befffau, 0xa4506cebu, 0xbef9a3f7u, 0xc67178f2u};
+
+std::uint32_t loadBigEndian(const unsigned char *bytes) {
+  return (static_cast<std::uint32_t>(bytes[0]) << 24) |
+         (static_cast<std::uint32_t>(bytes[1]) << 16) |
+         (static_cast<std::uint32_t>(bytes[2]) << 8) |
+         static_cast<std::uint32_t>(bytes[3]);
+}
+
+} // namespace
+
+Hasher::Hasher(const HashAlgorithm algorithm) : hashAlgorithm(algorithm) {
+  reset();
+}
+
+void Hasher::reset() {
+  state.fill(0);
+  if (hashAlgorithm == HashAlgorithm::SHA256) {
+    state = kSHA256Initial;
+  } else {
+    std::copy(kSHA1Initial.begin(), kSHA1Initial.end(), state.begin());
+  }
+  blockUsed = 0;
+  messageLength = 0;
+}
+/// <summary>
+/// Add bytes to the message, compressing each 64 byte block as it fills.
+/// Whole blocks are compressed straight from the input.
+/// </summary>
+/// <param name="bytes">Message bytes.</param>
+void Hasher::update(const std::string_view bytes) {
+  const auto *input = reinterpret_cast<const unsigned char *>(bytes.data());
+  std::size_t remaining = bytes.size();
+  messageLength += remaining;
+  if (blockUsed > 0) {
+    const std::size_t take = std::min(remaining, block.size() - blockUsed);
+    std::memcpy(block.data() + blockUsed, input, take);
+    blockUsed += take;
+    input += take;
+    remaining -= take;
+    if (blockUsed < block.size()) {
+      return;
+    }
+    compress(block.data());
+    blockUsed = 0;
+  }
+  for (; remaining >= block.size();
+       input += block.size(), remaining -= block.size()) {
+    compress(input);
+  }
+  std::memcpy(block.data(), input, remaining);
+  blockUsed = remaining;
+}
+
+void Hasher::update(const char byte) {
+  block[blockUsed++] = static_cast<unsigned char>(byte);
+  ++messageLength;
+  if (blockUsed == block.size()) {
+    compress(block.data());
+    blockUsed = 0;
+  }
+}
+/// <summary>
+/// Pad the message with its bit length and return the digest.
+/// </summary>
+/// <returns>Raw digest bytes.</returns>
+std::string Hasher::digest() {
+  const std::uint64_t bitLength = messageLength * 8;
+  block[blockUsed++] = 0x80;
+  if (blockUsed > block.size() - 8) {
+    std::memset(block.data() + blockUsed, 0, block.size() - blockUsed);
+    compress(block.data());
+    blockUsed = 0;
+  }
+  std::memset(block.data() + blockUsed, 0, block.size() - 8 - blockUsed);
+  for (std::size_t index = 0; index < 8; ++index) {
+    block[block.size() - 1 - index] =
+        static_cast<unsigned char>(bitLength >> (index * 8));
+  }
+  compress(block.data());
+  const std::size_t words = hashAlgorithm == HashAlgorithm::SHA256 ? 8 : 5;
+  std::string result(words * 4, '\0');
+  for (std::size_t word = 0; word < words; ++word) {
+    for (std::size_t byte = 0; byte < 4; ++byte) {
+      result[(word * 4) + byte] =
+          static_cast<char>(state[word] >> (24 - (byte * 8)));
+    }
+  }
+  reset();
+  return result;
+}
+
+std::string Hasher::toHex(const std::string_view digest) {
+  constexpr std::string_view kHexDigits{"0123456789abcdef"};
+  std::string hex;
+  hex.reserve(digest.size() * 2);
+  for (const char byte : digest) {
+    hex += kHexDigits[(static_cast<unsigned char>(byte) >> 4) & 0x0f];
+    hex += kHexDigits[static_cast<unsigned char>(byte) & 0x0f];
+  }
+  return hex;
+}
+
+void Hasher::compress(const unsigned char *block) {
+  if (hashAlgorithm == HashAlgorithm::SHA256) {
+    compressSHA256(block);
+  } else {
+    compressSHA1(block);
+  }
+}
+
+void Hasher::compressSHA1(const unsigned char *block) {
+  std::array<std::uint32_t, 80> schedule;
+  for (std::size_t word = 0; word < 16; ++word) {
+    schedule[word] = loadBigEndian(block + (word * 4));
+  }
+  for (std::size_t word = 16; word < 80; ++word) {
+    schedule[word] = std::rotl(schedule[word - 3] ^ schedule[word - 8] ^
+                                   schedule[word - 14] ^ schedule[word - 16],
+                               1);
+  }
+  std::uint32_t a = state[0];
+  std::uint32_t b = state[1];
+  std::uint32_t c = state[2];
+  std::uint32_t d = state[3];
+  std::uint32_t e = state[4];
+  for (std::size_t round = 0; round < 80; ++round) {
+    std::uint32_t mix;
+    std::uint32_t constant;
+    if (round < 20) {
+      mix = (b & c) | (~b & d);
+      constant = 0x5A827999u;
+    } else if (round < 40) {
+      mix = b ^ c ^ d;
+      constant = 0x6ED9EBA1u;
+    } else if (round < 60) {
+      mix = (b & c) | (b & d) | (c & d);
+      constant = 0x8F1BBCDCu;
+    } else {
+      mix = b ^ c ^ d;
+      constant = 0xCA62C1D6u;
+    }
+    const std::uint32_t next =
+        std::rotl(a, 5) + mix + e + constant + schedule[round];
+    e = d;
+    d = c;
+    c = std::rotl(b, 30);
+    b = a;
+    a = next;
+  }
+  state[0] += a;
+  state[1] += b;
+  state[2] += c;
+  state[3] += d;
+  state[4] += e;
+}
+
+void Hasher::compressSHA256(const unsigned char *block) {
+  std::array<std::uint32_t, 64> schedule;
+  for (std::size_t word = 0; word < 16; ++word) {
+    schedule[word] = loadBigEndian(block + (word * 4));
+  }
+  for (std::size_t word = 16; word < 64; ++word) {
+    const std::uint32_t s0 = std::rotr(schedule[word - 15], 7) ^
+                             std::rotr(schedule[word - 15], 18) ^
+                             (schedule[word - 15] >> 3);
+    const std::uint32_t s1 = std::rotr(schedule[word - 2], 17) ^
+                             std::rotr(schedule[word - 2], 19) ^
+                             (schedule[word - 2] >> 10);
+    schedule[word] = schedule[word - 16] + s0 + schedule[word - 7] + s1;
+  }
+  std::array<std::uint32_t, 8> working = state;
+  for (std::size_t round = 0; round < 64; ++round) {
+    auto &[a, b, c, d, e, f, g, h] = working;
+    const std::uint32_t s1 =
+        std::rotr(e, 6) ^ std::rotr(e, 11) ^ std::rotr(e, 25);
+    const std::uint32_t choose = (e & f) ^ (~e & g);
+    const std::uint32_t first =
+        h + s1 + choose + kSHA256Rounds[round] + schedule[round];
+    const std::uint32_t s0 =
+        std::rotr(a, 2) ^ std::rotr(a, 13) ^ std::rotr(a, 22);
+    const std::uint32_t majority = (a & b) ^ (a & c) ^ (b & c);
+    const std::uint32_t second = s0 + majority;
+    h = g;
+    g = f;
+    f = e;
+    e = d + first;
+    d = c;
+    c = b;
+    b = a;
+    a = first + second;
+  }
+  for (std::size_t word = 0; word < 8; ++word) {
+    state[word] += working[word];
+  }
+}
+
+} // namespace Bencode_Lib
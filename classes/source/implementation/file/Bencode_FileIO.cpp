@@ -12,9 +12,10 @@
 #include "Bencode_Error.hpp"
 #include "Bencode_FileIO_Internal.hpp"
 
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <string>
-#include <vector>
 
 namespace Bencode_Lib {
 
@@ -84,12 +85,12 @@ void writeBencodeString(FILE *bencodeFile,
 std::string readBencodeString(FILE *bencodeFile) {
   ensureFileOpen(bencodeFile, "File stream is not open for reading.");
 
-  std::vector<char> buffer;
+  std::string buffer;
   char chunk[4096];
   while (true) {
     std::size_t count = std::fread(chunk, 1, sizeof(chunk), bencodeFile);
     if (count > 0) {
-      buffer.insert(buffer.end(), chunk, chunk + count);
+      buffer.append(chunk, count);
     }
     if (count < sizeof(chunk)) {
       if (std::ferror(bencodeFile)) {
@@ -98,15 +99,389 @@ std::string readBencodeString(FILE *bencodeFile) {
       break;
     }
   }
-  return std::string(buffer.begin(), buffer.end());
+  return buffer;
 }
 
-std::string Bencode_Impl::fromFile(const std::string_view &fileName) {
-  Bencode_FileHandle file = openFileOrThrow(
-      fileName, Bencode_FileHandle::Mode::Read,
-      "Bencode file input stream failed to open or does not exist.");
+FileSource::FileSource(const std::string_view &sourceFileName,
+                       const std::size_t blockSize)
+    : source(nullptr), ownsSource(true), filename(sourceFileName),
+      buffer(std::max<std::size_t>(blockSize, 1)) {
+  if (!openBencodeFileForRead(filename, source)) {
+    throw Error("Bencode file input stream failed to open or does not exist.");
+  }
+}
+
+FileSource::FileSource(FILE *sourceStream, const std::string_view &streamName,
+                       const std::size_t blockSize)
+    : source(sourceStream), ownsSource(false), filename(streamName),
+      buffer(std::max<std::size_t>(blockSize, 1)) {
+  if (!source) {
+    throw Error("Bencode file input stream is not open.");
+  }
+}
+
+std::size_t FileSource::readBlock(char *destination,
+                                  const std::size_t length) const {
+  return readBencodeFileBlock(source, destination, length);
+}
+
+bool FileSource::fill(const std::size_t count) const {
+  if (bufferFilled - bufferPosition >= count) {
+    return true;
+  }
+  if (!source || endOfInput) {
+    return bufferPosition < bufferFilled;
+  }
+  // Move any unread bytes to the front before reading more
+  if (bufferPosition > 0) {
+    std::memmove(buffer.data(), buffer.data() + bufferPosition,
+                 bufferFilled - bufferPosition);
+    bufferFilled -= bufferPosition;
+    bufferOffset += bufferPosition;
+    bufferPosition = 0;
+  }
+  while (bufferFilled < count) {
+    // Only windows larger than the block size grow the buffer
+    if (bufferFilled == buffer.size()) {
+      buffer.resize(buffer.size() * 2);
+    }
+    const std::size_t bytesRead =
+        readBlock(buffer.data() + bufferFilled, buffer.size() - bufferFilled);
+    if (bytesRead == 0) {
+      endOfInput = true;
+      break;
+    }
+    bufferFilled += bytesRead;
+  }
+  return bufferPosition < bufferFilled;
+}
+
+void FileSource::read(char *destination, std::size_t count) {
+  std::size_t available = std::min(count, bufferFilled - bufferPosition);
+  std::memcpy(destination, buffer.data() + bufferPosition, available);
+  bufferPosition += available;
+  destination += available;
+  count -= available;
+  if (count >= buffer.size()) {
+    // Large payloads are read straight into the destination
+    bufferOffset += bufferFilled;
+    bufferPosition = 0;
+    bufferFilled = 0;
+    while (count >= buffer.size()) {
+      const std::size_t bytesRead =
+          source && !endOfInput ? readBlock(destination, count) : 0;
+      if (bytesRead == 0) {
+        endOfInput = true;
+        throw Error("Parse buffer empty before parse complete.");
+      }
+      bufferOffset += bytesRead;
+      destination += bytesRead;
+      count -= bytesRead;
+    }
+  }
+  if (count > 0) {
+    fill(count);
+    if (bufferFilled - bufferPosition < count) {
+      throw Error("Parse buffer empty before parse complete.");
+    }
+    std::memcpy(destination, buffer.data() + bufferPosition, count);
+    bufferPosition += count;
+  }
+}
+
+void FileSource::skip(std::size_t count) {
+  while (count > 0) {
+    if (!fill(1)) {
+      throw Error("Parse buffer empty before parse complete.");
+    }
+    const std::size_t available =
+        std::min(count, bufferFilled - bufferPosition);
+    bufferPosition += available;
+    count -= available;
+  }
+}
+
+void FileSource::reset() {
+  if (!source) {
+    return;
+  }
+  // Still holding the start of the stream (always the case for short pipes)
+  if (bufferOffset == 0) {
+    bufferPosition = 0;
+    return;
+  }
+  if (!rewindBencodeFile(source)) {
+    throw Error("Bencode file input stream cannot be reset.");
+  }
+  bufferOffset = 0;
+  bufferPosition = 0;
+  bufferFilled = 0;
+  endOfInput = false;
+}
+
+MmapFileSource::MmapFileSource(const std::string_view &sourceFileName)
+    : filename(sourceFileName) {
+  if (!mapBencodeFileForRead(filename, bufferStart, bufferLength, mapped,
+                             fallbackBuffer)) {
+    throw Error("Bencode file input stream failed to open or does not exist.");
+  }
+}
+
+MmapFileSource::~MmapFileSource() {
+  if (mapped) {
+    unmapBencodeFile(bufferStart, bufferLength);
+  }
+}
+
+FileDestination::FileDestination(const std::string_view filename,
+                                 const std::size_t bufferSize)
+    : destination(nullptr), filename(filename),
+      buffer(std::max<std::size_t>(bufferSize, 1)) {
+  open();
+}
 
-  return readBencodeString(file.get());
+FileDestination::~FileDestination() {
+  try {
+    close();
+  } catch (...) {
+    // Destruction cannot report write errors; close() explicitly for them
+  }
+}
+
+void FileDestination::open() {
+  if (!openBencodeFileForWrite(filename, destination)) {
+    throw Error(
+        "Bencode file output stream failed to open or could not be created.");
+  }
+  // Writes are already buffered here so stdio buffering would only add a copy
+  std::setvbuf(destination, nullptr, _IONBF, 0);
+}
+
+void FileDestination::writeBytes(const char *data, const std::size_t size) {
+  if (!destination) {
+    throw Error("File output stream is not open.");
+  }
+  if (size == 0) {
+    return;
+  }
+  if (size <= buffer.size() - buffered) {
+    std::memcpy(buffer.data() + buffered, data, size);
+    buffered += size;
+  } else {
+    flushBuffer();
+    if (size < buffer.size()) {
+      std::memcpy(buffer.data(), data, size);
+      buffered = size;
+    } else if (std::fwrite(data, 1, size, destination) != size) {
+      throw Error("Failed to write bytes to file output stream.");
+    }
+  }
+  length += size;
+  lastChar = data[size - 1];
+}
+
+void FileDestination::flushBuffer() {
+  if (!destination) {
+    throw Error("File output stream is not open.");
+  }
+  if (buffered > 0 &&
+      std::fwrite(buffer.data(), 1, buffered, destination) != buffered) {
+    buffered = 0;
+    throw Error("Failed to write bytes to file output stream.");
+  }
+  buffered = 0;
+}
+
+void FileDestination::flush() {
+  flushBuffer();
+  if (std::fflush(destination) != 0) {
+    throw Error("Failed to flush file output stream.");
+  }
+}
+
+void FileDestination::sync() {
+  flush();
+  if (!syncBencodeFile(destination)) {
+    throw Error("Failed to commit file output stream to storage.");
+  }
+}
+
+void FileDestination::close() {
+  if (!destination) {
+    return;
+  }
+  FILE *file = destination;
+  try {
+    flush();
+  } catch (...) {
+    std::fclose(file);
+    destination = nullptr;
+    throw;
+  }
+  destination = nullptr;
+  if (std::fclose(file) != 0) {
+    throw Error("Failed to close file output stream.");
+  }
+}
+
+void FileDestination::clear() {
+  if (destination) {
+    std::fclose(destination);
+    destination = nullptr;
+  }
+  buffered = 0;
+  length = 0;
+  lastChar = 0;
+  open();
+}
+
+GatherDestination::GatherDestination(const std::string_view filename,
+                                     const std::size_t referenceSize,
+                                     const std::size_t bufferSize)
+    : referenceSize(std::max<std::size_t>(referenceSize, 1)),
+      buffer(std::max<std::size_t>(bufferSize, 1)) {
+  if (!openBencodeFileForWrite(std::string(filename), file)) {
+    throw Error(
+        "Bencode file output stream failed to open or could not be created.");
+  }
+  descriptor = bencodeFileDescriptor(file);
+  segments.reserve(kMaxSegments);
+}
+
+GatherDestination::GatherDestination(const int descriptor,
+                                     const std::size_t referenceSize,
+                                     const std::size_t bufferSize)
+    : descriptor(descriptor),
+      referenceSize(std::max<std::size_t>(referenceSize, 1)),
+      buffer(std::max<std::size_t>(bufferSize, 1)) {
+  if (descriptor < 0) {
+    throw Error("Invalid output descriptor.");
+  }
+  segments.reserve(kMaxSegments);
+}
+
+GatherDestination::~GatherDestination() {
+  try {
+    close();
+  } catch (...) {
+    // Destruction cannot report write errors; close() explicitly for them
+  }
+}
+/// <summary>
+/// Copy bytes into the side buffer, extending the last segment when it ends
+/// where they are placed. Bytes that do not fit in an empty side buffer are
+/// written straight away as the caller's storage need not outlive the call.
+/// </summary>
+/// <param name="data">Bytes to add.</param>
+/// <param name="size">Number of bytes.</param>
+void GatherDestination::copyBytes(const char *data, const std::size_t size) {
+  if (descriptor < 0) {
+    throw Error("File output stream is not open.");
+  }
+  if (size == 0) {
+    return;
+  }
+  if (size > buffer.size() - buffered) {
+    flush();
+  }
+  if (size > buffer.size()) {
+    segments.emplace_back(data, size);
+    flush();
+  } else {
+    char *target = buffer.data() + buffered;
+    std::memcpy(target, data, size);
+    buffered += size;
+    if (!segments.empty() &&
+        segments.back().data() + segments.back().size() == target) {
+      segments.back() = {segments.back().data(), segments.back().size() + size};
+    } else {
+      segments.emplace_back(target, size);
+      if (segments.size() == kMaxSegments) {
+        flush();
+      }
+    }
+  }
+  length += size;
+  lastChar = data[size - 1];
+}
+
+void GatherDestination::referenceBytes(const std::string_view bytes) {
+  if (descriptor < 0) {
+    throw Error("File output stream is not open.");
+  }
+  if (bytes.empty()) {
+    return;
+  }
+  segments.push_back(bytes);
+  length += bytes.size();
+  referenced += bytes.size();
+  lastChar = bytes.back();
+  if (segments.size() == kMaxSegments) {
+    flush();
+  }
+}
+
+void GatherDestination::flush() {
+  if (descriptor < 0) {
+    throw Error("File output stream is not open.");
+  }
+  const bool written =
+      writeBencodeSegments(descriptor, segments.data(), segments.size());
+  segments.clear();
+  buffered = 0;
+  if (!written) {
+    throw Error("Failed to write bytes to file output stream.");
+  }
+}
+
+void GatherDestination::close() {
+  if (descriptor < 0) {
+    return;
+  }
+  try {
+    flush();
+  } catch (...) {
+    if (file != nullptr) {
+      std::fclose(file);
+      file = nullptr;
+    }
+    descriptor = -1;
+    throw;
+  }
+  descriptor = -1;
+  if (file != nullptr) {
+    FILE *closing = file;
+    file = nullptr;
+    if (std::fclose(closing) != 0) {
+      throw Error("Failed to close file output stream.");
+    }
+  }
+}
+
+void GatherDestination::clear() {
+  segments.clear();
+  buffered = 0;
+  length = 0;
+  referenced = 0;
+  lastChar = 0;
+}
+
+std::string Bencode_Impl::fromFile(const std::string_view &fileName) {
+  // Regular files are copied once, straight from the mapping
+  const std::string path(fileName);
+  const char *data = nullptr;
+  std::size_t length = 0;
+  bool mapped = false;
+  std::string fallback;
+  if (!mapBencodeFileForRead(path, data, length, mapped, fallback)) {
+    throw Error("Bencode file input stream failed to open or does not exist.");
+  }
+  if (!mapped) {
+    return fallback;
+  }
+  std::string bencodeString(data, length);
+  unmapBencodeFile(data, length);
+  return bencodeString;
 }
 
 void Bencode_Impl::toFile(const std::string_view &fileName,
@@ -3,8 +3,10 @@
 // Description: MSVC-compatible file open functions used by the Bencode file I/O wrapper.
 
 #include "Bencode_FileIO_Internal.hpp"
+#include "ISource.hpp"
 
 #include <cstdio>
+#include <io.h>
 #include <string>
 
 namespace Bencode_Lib {
@@ -17,4 +19,64 @@ bool openBencodeFileForWrite(const std::string &path, FILE *&file) {
   return fopen_s(&file, path.c_str(), "wb") == 0 && file != nullptr;
 }
 
+std::size_t readBencodeFileBlock(FILE *file, char *buffer,
+                                 const std::size_t length) {
+  const std::size_t bytesRead = std::fread(buffer, 1, length, file);
+  if (bytesRead < length && std::ferror(file)) {
+    throw ISource::Error("Failed to read from Bencode file input stream.");
+  }
+  return bytesRead;
+}
+
+bool rewindBencodeFile(FILE *file) {
+  return std::fseek(file, 0, SEEK_SET) == 0;
+}
+
+bool syncBencodeFile(FILE *file) { return _commit(_fileno(file)) == 0; }
+
+int bencodeFileDescriptor(FILE *file) { return _fileno(file); }
+
+// There is no writev() here so the segments are written one at a time
+bool writeBencodeSegments(const int descriptor,
+                          const std::string_view *segments,
+                          const std::size_t count) {
+  constexpr std::size_t kMaxWrite = 1u << 30;
+  for (std::size_t index = 0; index < count; ++index) {
+    const char *data = segments[index].data();
+    std::size_t remaining = segments[index].size();
+    while (remaining > 0) {
+      const int written = _write(descriptor, data,
+                                 static_cast<unsigned int>(
+                                     remaining < kMaxWrite ? remaining
+                                                           : kMaxWrite));
+      if (written <= 0) {
+        return false;
+      }
+      data += written;
+      remaining -= static_cast<std::size_t>(written);
+    }
+  }
+  return true;
+}
+
+// Memory mapping is not used on this platform; the whole file is read into
+// the fallback buffer instead.
+bool mapBencodeFileForRead(const std::string &path, const char *&data,
+                           std::size_t &length, bool &mapped,
+                           std::string &fallback) {
+  FILE *file = nullptr;
+  if (!openBencodeFileForRead(path, file)) {
+    return false;
+  }
+  fallback = readBencodeString(file);
+  std::fclose(file);
+  data = fallback.data();
+  length = fallback.size();
+  mapped = false;
+  return true;
+}
+
+void unmapBencodeFile([[maybe_unused]] const char *data,
+                      [[maybe_unused]] std::size_t length) {}
+
 } // namespace Bencode_Lib
@@ -3,10 +3,21 @@
 // Description: POSIX-compatible file open functions used by the Bencode file I/O wrapper.
 
 #include "Bencode_FileIO_Internal.hpp"
+#include "ISource.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <climits>
 #include <cstdio>
 #include <string>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
 namespace Bencode_Lib {
 
 bool openBencodeFileForRead(const std::string &path, FILE *&file) {
@@ -19,4 +30,134 @@ bool openBencodeFileForWrite(const std::string &path, FILE *&file) {
   return file != nullptr;
 }
 
+std::size_t readBencodeFileBlock(FILE *file, char *buffer,
+                                 const std::size_t length) {
+  while (true) {
+    const ssize_t bytesRead = ::read(::fileno(file), buffer, length);
+    if (bytesRead >= 0) {
+      return static_cast<std::size_t>(bytesRead);
+    }
+    if (errno != EINTR) {
+      throw ISource::Error("Failed to read from Bencode file input stream.");
+    }
+  }
+}
+
+bool rewindBencodeFile(FILE *file) {
+  return ::lseek(::fileno(file), 0, SEEK_SET) == 0;
+}
+
+bool syncBencodeFile(FILE *file) { return ::fsync(::fileno(file)) == 0; }
+
+int bencodeFileDescriptor(FILE *file) { return ::fileno(file); }
+
+bool writeBencodeSegments(const int descriptor,
+                          const std::string_view *segments,
+                          const std::size_t count) {
+#ifdef IOV_MAX
+  constexpr std::size_t kBatchSize = IOV_MAX;
+#else
+  constexpr std::size_t kBatchSize = 16; // _XOPEN_IOV_MAX
+#endif
+  std::array<iovec, kBatchSize> batch;
+  std::size_t next = 0;
+  while (next < count) {
+    const std::size_t batchCount = std::min(count - next, kBatchSize);
+    for (std::size_t index = 0; index < batchCount; ++index) {
+      batch[index].iov_base = const_cast<char *>(segments[next + index].data());
+      batch[index].iov_len = segments[next + index].size();
+    }
+    next += batchCount;
+    iovec *pending = batch.data();
+    std::size_t pendingCount = batchCount;
+    while (pendingCount > 0) {
+      const ssize_t written =
+          ::writev(descriptor, pending, static_cast<int>(pendingCount));
+      if (written < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return false;
+      }
+      // Step past what was written, resuming a partly written segment
+      auto remaining = static_cast<std::size_t>(written);
+      while (pendingCount > 0 && remaining >= pending->iov_len) {
+        remaining -= pending->iov_len;
+        ++pending;
+        --pendingCount;
+      }
+      if (pendingCount > 0) {
+        pending->iov_base = static_cast<char *>(pending->iov_base) + remaining;
+        pending->iov_len -= remaining;
+      }
+    }
+  }
+  return true;
+}
+
+static bool readBencodeDescriptor(const int descriptor, std::string &buffer) {
+  constexpr std::size_t kReadBlockSize = 64 * 1024;
+  std::size_t used = buffer.size();
+  while (true) {
+    buffer.resize(used + kReadBlockSize);
+    const ssize_t bytesRead = ::read(descriptor, buffer.data() + used,
+                                     kReadBlockSize);
+    if (bytesRead < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      buffer.resize(used);
+      return false;
+    }
+    if (bytesRead == 0) {
+      break;
+    }
+    used += static_cast<std::size_t>(bytesRead);
+  }
+  buffer.resize(used);
+  return true;
+}
+
+bool mapBencodeFileForRead(const std::string &path, const char *&data,
+                           std::size_t &length, bool &mapped,
+                           std::string &fallback) {
+  const int descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (descriptor < 0) {
+    return false;
+  }
+  struct stat status {};
+  if (::fstat(descriptor, &status) == 0 && S_ISREG(status.st_mode) &&
+      status.st_size > 0) {
+    const auto size = static_cast<std::size_t>(status.st_size);
+    void *mapping =
+        ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    if (mapping != MAP_FAILED) {
+#if defined(MADV_SEQUENTIAL)
+      ::madvise(mapping, size, MADV_SEQUENTIAL);
+#endif
+#if defined(MADV_WILLNEED)
+      ::madvise(mapping, size, MADV_WILLNEED);
+#endif
+      ::close(descriptor);
+      data = static_cast<const char *>(mapping);
+      length = size;
+      mapped = true;
+      return true;
+    }
+  }
+  // Pipes, devices and files that cannot be mapped are read in blocks
+  const bool success = readBencodeDescriptor(descriptor, fallback);
+  ::close(descriptor);
+  data = fallback.data();
+  length = fallback.size();
+  mapped = false;
+  return success;
+}
+
+void unmapBencodeFile(const char *data, const std::size_t length) {
+  if (data != nullptr && length > 0) {
+    ::munmap(const_cast<char *>(data), length);
+  }
+}
+
 } // namespace Bencode_Lib
@@ -0,0 +1,86 @@
+// File: Bencode_Arena.cpp
+//
+// Description: Source implementation of the document arena and its huge page
+// upstream resource.
+//
+
+#include "Bencode_Arena.hpp"
+
+#include <cstdint>
+#include <new>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace Bencode_Lib {
+
+namespace {
+
+#if defined(__linux__)
+// Arena blocks mapped in whole huge pages and advised to use them
+class HugePageResource final : public std::pmr::memory_resource {
+  static constexpr std::size_t kHugePageSize = 2 * 1024 * 1024;
+  static std::size_t mappedSize(const std::size_t bytes) {
+    return (bytes + kHugePageSize - 1) & ~(kHugePageSize - 1);
+  }
+  // mmap() only aligns to the base page size, so an extra huge page is
+  // mapped and the slack either side of the first 2 MiB boundary unmapped;
+  // otherwise the block rarely holds an aligned huge page to promote
+  void *do_allocate(const std::size_t bytes,
+                    [[maybe_unused]] const std::size_t alignment) override {
+    const std::size_t size = mappedSize(bytes);
+    void *mapping = mmap(nullptr, size + kHugePageSize, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED) {
+      throw std::bad_alloc();
+    }
+    const auto start = reinterpret_cast<std::uintptr_t>(mapping);
+    const std::uintptr_t aligned =
+        (start + kHugePageSize - 1) & ~(std::uintptr_t{kHugePageSize} - 1);
+    if (aligned > start) {
+      munmap(mapping, aligned - start);
+    }
+    if (const std::size_t tail = kHugePageSize - (aligned - start); tail > 0) {
+      munmap(reinterpret_cast<void *>(aligned + size), tail);
+    }
+    void *block = reinterpret_cast<void *>(aligned);
+    madvise(block, size, MADV_HUGEPAGE);
+    return block;
+  }
+  void do_deallocate(void *block, const std::size_t bytes,
+                     [[maybe_unused]] const std::size_t alignment) override {
+    munmap(block, mappedSize(bytes));
+  }
+  [[nodiscard]] bool
+  do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+#endif
+
+std::unique_ptr<std::pmr::memory_resource>
+makeHugePageResource(const ArenaOptions &options) {
+#if defined(__linux__)
+  if (options.hugePages && options.upstream == nullptr) {
+    return std::make_unique<HugePageResource>();
+  }
+#else
+  (void)options;
+#endif
+  return nullptr;
+}
+
+} // namespace
+
+Bencode_Arena::Bencode_Arena(const ArenaOptions &options)
+    : hugePages(makeHugePageResource(options)),
+      monotonic(options.initialSize,
+                hugePages != nullptr         ? hugePages.get()
+                : options.upstream != nullptr ? options.upstream
+                                              : std::pmr::new_delete_resource()) {
+}
+
+Bencode_Arena::~Bencode_Arena() = default;
+
+} // namespace Bencode_Lib
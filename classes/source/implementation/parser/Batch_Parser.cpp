@@ -0,0 +1,157 @@
+// File: Batch_Parser.cpp
+//
+// Description: Source implementation of the batch parser.
+//
+
+#include "Batch_Parser.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#if !BENCODE_EMBEDDED_MODE
+#include <thread>
+#endif
+
+namespace Bencode_Lib {
+
+namespace {
+
+// Parse a source into a result, turning exceptions into its status
+void parseSource(ISource &source, const ParseOptions &options,
+                 Batch_Parser::Result &result) {
+  Default_Parser parser{options};
+#if BENCODE_ENABLE_EXCEPTIONS
+  result.root = parser.parse(source);
+#else
+  result.status = parser.parse(source, result.root);
+#endif
+  result.digest = parser.digest();
+  // Input left after the value is rejected, as it is by Bencode::parse()
+  if (result.status.ok() && source.more()) {
+    result.root = Node{};
+#if BENCODE_ENABLE_EXCEPTIONS
+    // Worded as the exception Bencode::parse throws, like the other messages
+    result.status = ParseStatus::failure(
+        ErrorCode::SourceTerminatedEarly,
+        SyntaxError("Source stream terminated early.").what());
+#else
+    result.status = ParseStatus::failure(ErrorCode::SourceTerminatedEarly,
+                                         "Source stream terminated early.");
+#endif
+  }
+}
+
+#if BENCODE_ENABLE_EXCEPTIONS
+template <typename Parse>
+void captureStatus(Batch_Parser::Result &result, const Parse &parse) {
+  try {
+    parse();
+  } catch (const SyntaxError &error) {
+    result.status = ParseStatus::failure(ErrorCode::SyntaxError, error.what());
+  } catch (const std::out_of_range &error) {
+    result.status =
+        ParseStatus::failure(ErrorCode::IntegerOverflow, error.what());
+  } catch (const std::exception &error) {
+    result.status = ParseStatus::failure(ErrorCode::IOError, error.what());
+  }
+}
+#else
+template <typename Parse>
+void captureStatus([[maybe_unused]] Batch_Parser::Result &result,
+                   const Parse &parse) {
+  parse();
+}
+#endif
+
+#if !BENCODE_EMBEDDED_MODE
+// Joins the workers started so far when it goes out of scope, so that a
+// std::thread constructor throwing part way through filling the pool does
+// not destroy joinable threads (std::terminate)
+struct PoolJoiner {
+  std::vector<std::thread> &pool;
+  ~PoolJoiner() {
+    for (std::thread &thread : pool) {
+      if (thread.joinable()) {
+        thread.join();
+      }
+    }
+  }
+};
+#endif
+
+} // namespace
+
+Batch_Parser::Batch_Parser(const unsigned int threads,
+                           const ParseOptions &options)
+    : threads(threads), options(options) {
+#if BENCODE_EMBEDDED_MODE
+  this->threads = 1;
+#else
+  if (this->threads == 0) {
+    this->threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+#endif
+}
+/// <summary>
+/// Run the item parser for every item index across the workers; each worker
+/// takes the next unclaimed index until none are left.
+/// </summary>
+/// <param name="count">Number of items.</param>
+/// <param name="parseItem">Parse the item with a given index.</param>
+void Batch_Parser::run(
+    const std::size_t count,
+    const std::function<void(std::size_t)> &parseItem) const {
+  std::atomic<std::size_t> next{0};
+  auto worker = [&]() {
+    for (std::size_t item = next++; item < count; item = next++) {
+      parseItem(item);
+    }
+  };
+#if BENCODE_EMBEDDED_MODE
+  worker();
+#else
+  std::vector<std::thread> pool;
+  const std::size_t poolSize = std::min<std::size_t>(threads, count);
+  pool.reserve(poolSize > 0 ? poolSize - 1 : 0);
+  const PoolJoiner joiner{pool};
+  for (std::size_t thread = 1; thread < poolSize; ++thread) {
+    pool.emplace_back(worker);
+  }
+  worker();
+#endif
+}
+
+std::vector<Batch_Parser::Result>
+Batch_Parser::parseBuffers(const std::vector<std::string_view> &buffers) const {
+  std::vector<Result> results(buffers.size());
+  run(buffers.size(), [&](const std::size_t item) {
+    captureStatus(results[item], [&]() {
+      BufferSource source{buffers[item]};
+      parseSource(source, options, results[item]);
+    });
+  });
+  return results;
+}
+
+#if BENCODE_ENABLE_FILE_IO
+
+std::vector<Batch_Parser::Result>
+Batch_Parser::parseFiles(const std::vector<std::string> &fileNames) const {
+  std::vector<Result> results(fileNames.size());
+  run(fileNames.size(), [&](const std::size_t item) {
+    captureStatus(results[item], [&]() {
+      auto source = std::make_shared<MmapFileSource>(fileNames[item]);
+      parseSource(*source, options, results[item]);
+      // Borrowed strings and source ranges refer to the mapping
+      if (results[item].ok() && (options.strings == StringStorage::Borrowed ||
+                                 options.sourceRanges)) {
+        results[item].source = std::move(source);
+      }
+    });
+  });
+  return results;
+}
+
+#endif
+
+} // namespace Bencode_Lib
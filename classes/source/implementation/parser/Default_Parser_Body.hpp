@@ -12,6 +12,36 @@
 
 namespace Bencode_Lib {
 
+/// <summary>
+/// Return true if a container about to be pushed onto the frame stack lies
+/// along the requested hash key path.
+/// </summary>
+/// <param name="frameStack">Current parser frame stack.</param>
+/// <param name="path">Dictionary key path being hashed.</param>
+/// <returns>true if the new container continues the hash path.</returns>
+static bool continuesHashPath(const std::vector<ParserFrame> &frameStack,
+                              const std::vector<std::string> &path) {
+  if (frameStack.empty()) {
+    return true;
+  }
+  const ParserFrame &parent = frameStack.back();
+  return parent.onHashPath && parent.type == ContainerType::Dictionary &&
+         frameStack.size() <= path.size() &&
+         parent.key() == path[frameStack.size() - 1];
+}
+/// <summary>
+/// Return true if the value about to be parsed for the current dictionary key
+/// is the one named by the hash key path.
+/// </summary>
+/// <param name="frameStack">Current parser frame stack.</param>
+/// <param name="path">Dictionary key path being hashed.</param>
+/// <returns>true if the next value is the hash target.</returns>
+static bool atHashTarget(const std::vector<ParserFrame> &frameStack,
+                         const std::vector<std::string> &path) {
+  return !frameStack.empty() && frameStack.size() == path.size() &&
+         continuesHashPath(frameStack, path);
+}
+
 #if BENCODE_ENABLE_EXCEPTIONS
 
 /// <summary>
@@ -21,33 +51,19 @@ namespace Bencode_Lib {
 /// <param name="source">Reference to input interface used to parse Bencoded
 /// stream.</param> <returns>Positive integers value.</returns>
 Bencode::IntegerType Default_Parser::extractInteger(ISource &source) {
-  // Number size of 64 bit int +2 for sign and terminating null
-  std::array<char, std::numeric_limits<Bencode::IntegerType>::digits10 + 2>
-      number{};
-  std::size_t digits = 0;
-  if (source.current() == ParserConstants::STRING_MINUS) {
-    number[digits++] = source.current();
-    source.next();
-  }
-  while (source.more() && std::isdigit(source.current()) != 0) {
-    // Number too large to fit in buffer
-    if (digits == number.size()) {
-      throw SyntaxError("Integer to large to fit in conversion buffer.");
-    }
-    number[digits++] = source.current();
-    source.next();
-  }
-  // Check integer has no leading zero and is not empty ('i.e.')
-  if ((number[0] == '0' && digits > 1) || digits == 0) {
+  Bencode::IntegerType integer = 0;
+  switch (scanInteger(source, integer)) {
+  case IntegerScan::TooLarge:
+    throw SyntaxError("Integer to large to fit in conversion buffer.");
+  case IntegerScan::EmptyOrLeadingZero:
     throw SyntaxError("Empty Integer or has leading zero.");
-  }
-  // Check-for -0
-  if (number[0] == '-' && number[1] == '0' && digits == 2) {
+  case IntegerScan::NegativeZero:
     throw SyntaxError("Negative zero is not allowed.");
-  }
-  Bencode::IntegerType integer = 0;
-  if (!convertToInteger(number.data(), digits, integer)) {
+  case IntegerScan::Overflow:
     throw std::out_of_range("Integer conversion overflow.");
+  case IntegerScan::Ok:
+  default:
+    break;
   }
   return integer;
 }
@@ -74,6 +90,11 @@ Node Default_Parser::parseString(
   if (stringLength == 0) {
     return Node::make<String>();
   }
+  if (borrowing(source)) {
+    return Node::make<String>(
+        borrowPayload(source, static_cast<std::size_t>(stringLength)),
+        Borrowed{});
+  }
   Node result = Node::make<String>(static_cast<std::size_t>(stringLength));
   char *payload = NRef<String>(result).data();
   copySourceToBuffer(source, payload, static_cast<std::size_t>(stringLength));
@@ -201,17 +222,31 @@ Node Default_Parser::parseIterative(ISource &source) {
     throw SyntaxError("Unexpected end of source.");
   }
 
+  const bool recordRanges = recordingRanges(source);
   std::vector<ParserFrame> frameStack;
   frameStack.reserve(16);
   auto pushFrame = [&](ContainerType type) {
     if (frameStack.size() + 1 >= getMaxParserDepth()) {
       throw SyntaxError("Maximum parser depth exceeded.");
     }
+    const bool onPath =
+        hashTap != nullptr && continuesHashPath(frameStack, options.hashPath);
     frameStack.emplace_back(type);
+    frameStack.back().onHashPath = onPath;
+    if (recordRanges) {
+      frameStack.back().sourceBegin = source.position() - 1;
+    }
   };
 
   auto completeFrame = [&]() -> Node {
     Node completed = std::move(frameStack.back().container);
+    if (frameStack.back().hashTarget) {
+      pathDigest = hashTap->stop();
+    }
+    if (recordRanges) {
+      setSourceRange(completed,
+                     {frameStack.back().sourceBegin, source.position()});
+    }
     frameStack.pop_back();
     if (frameStack.empty()) {
       return completed;
@@ -225,8 +260,7 @@ Node Default_Parser::parseIterative(ISource &source) {
       }
       try {
         NRef<Dictionary>(parent.container)
-            .appendSorted(Dictionary::Entry(std::move(parent.currentKey),
-                                            std::move(completed)));
+            .appendSorted(parent.takeEntry(std::move(completed)));
       } catch (const Node::Error &error) {
         std::string message = error.what();
         constexpr std::string_view prefix("Node Error: ");
@@ -282,22 +316,31 @@ Node Default_Parser::parseIterative(ISource &source) {
       if (!source.more()) {
         throw SyntaxError("Unexpected end of source.");
       }
+      const bool target =
+          hashTap != nullptr && atHashTarget(frameStack, options.hashPath);
+      if (target) {
+        hashTap->start();
+      }
       if (source.current() == ParserConstants::DICTIONARY) {
         source.next();
         pushFrame(ContainerType::Dictionary);
+        frameStack.back().hashTarget = target;
         continue;
       }
       if (source.current() == ParserConstants::LIST) {
         source.next();
         pushFrame(ContainerType::List);
+        frameStack.back().hashTarget = target;
         continue;
       }
       Node valueNode = parseScalar(
           source, static_cast<unsigned long>(frameStack.size() + 1));
+      if (target) {
+        pathDigest = hashTap->stop();
+      }
       try {
         NRef<Dictionary>(frame.container)
-            .appendSorted(Dictionary::Entry(std::move(frame.currentKey),
-                                            std::move(valueNode)));
+            .appendSorted(frame.takeEntry(std::move(valueNode)));
       } catch (const Node::Error &error) {
         std::string message = error.what();
         constexpr std::string_view prefix("Node Error: ");
@@ -318,12 +361,23 @@ Node Default_Parser::parseIterative(ISource &source) {
       root = completeFrame();
       continue;
     }
-    parseStringKey(source, static_cast<unsigned long>(frameStack.size() + 1),
-                   frame.currentKey);
-    if (frame.lastKey > frame.currentKey) {
-      throw SyntaxError("Dictionary keys not in sequence.");
+    if (borrowing(source)) {
+      std::size_t length = 0;
+      throwOnFailure(scanStringLength(source, length));
+      const std::string_view key = borrowPayload(source, length);
+      if (frame.lastBorrowedKey > key) {
+        throw SyntaxError("Dictionary keys not in sequence.");
+      }
+      frame.lastBorrowedKey = frame.borrowedKey = key;
+    } else {
+      parseStringKey(source,
+                     static_cast<unsigned long>(frameStack.size() + 1),
+                     frame.currentKey);
+      if (frame.lastKey > frame.currentKey) {
+        throw SyntaxError("Dictionary keys not in sequence.");
+      }
+      frame.lastKey = frame.currentKey;
     }
-    frame.lastKey = frame.currentKey;
     frame.awaitingValue = true;
   }
 
@@ -381,13 +435,31 @@ Node Default_Parser::parseNodes(ISource &source,
   }
 }
 /// <summary>
-/// Parse a Node from the input stream of characters referenced by ISource to
-/// traverse and parse complex encodings. This method is called
-/// recursively to build up a Node structure.
+/// Parse Bencode from source, hashing the raw bytes of the value at the
+/// requested key path (or of the whole document for an empty path) as they
+/// are consumed.
 /// </summary>
 /// <param name="source">Reference to input interface used to parse Bencoded
-/// stream.</param> <returns>Root Node.</returns>
-Node Default_Parser::parseImpl(ISource &source) { return parseIterative(source); }
+/// stream.</param>
+/// <returns>Root Node.</returns>
+Node Default_Parser::parseImpl(ISource &source) {
+  pathDigest.clear();
+  hashTap = nullptr;
+  if (options.hash == HashAlgorithm::None) {
+    return parseIterative(source);
+  }
+  HashingSource tap{source, options.hash};
+  hashTap = &tap;
+  if (options.hashPath.empty()) {
+    tap.start();
+  }
+  Node root = parseIterative(tap);
+  if (options.hashPath.empty()) {
+    pathDigest = tap.stop();
+  }
+  hashTap = nullptr;
+  return root;
+}
 
 #else
 
@@ -397,29 +469,19 @@ static ParseStatus makeSyntaxError(const std::string_view &message) {
 
 ParseStatus Default_Parser::extractInteger(ISource &source,
                                            Bencode::IntegerType &number) {
-  std::array<char, std::numeric_limits<Bencode::IntegerType>::digits10 + 2>
-      buffer{};
-  std::size_t digits = 0;
-  if (source.current() == ParserConstants::STRING_MINUS) {
-    buffer[digits++] = source.current();
-    source.next();
-  }
-  while (source.more() && std::isdigit(source.current()) != 0) {
-    if (digits == buffer.size()) {
-      return makeSyntaxError("Integer to large to fit in conversion buffer.");
-    }
-    buffer[digits++] = source.current();
-    source.next();
-  }
-  if ((buffer[0] == '0' && digits > 1) || digits == 0) {
+  switch (scanInteger(source, number)) {
+  case IntegerScan::TooLarge:
+    return makeSyntaxError("Integer to large to fit in conversion buffer.");
+  case IntegerScan::EmptyOrLeadingZero:
     return makeSyntaxError("Empty Integer or has leading zero.");
-  }
-  if (buffer[0] == '-' && buffer[1] == '0' && digits == 2) {
+  case IntegerScan::NegativeZero:
     return makeSyntaxError("Negative zero is not allowed.");
-  }
-  if (!convertToInteger(buffer.data(), digits, number)) {
+  case IntegerScan::Overflow:
     return ParseStatus::failure(ErrorCode::IntegerOverflow,
                                 "Integer conversion overflow.");
+  case IntegerScan::Ok:
+  default:
+    break;
   }
   return ParseStatus::success();
 }
@@ -447,6 +509,12 @@ Default_Parser::parseString(ISource &source,
     destination = Node::make<String>();
     return ParseStatus::success();
   }
+  if (borrowing(source)) {
+    destination = Node::make<String>(
+        borrowPayload(source, static_cast<std::size_t>(stringLength)),
+        Borrowed{});
+    return ParseStatus::success();
+  }
   destination = Node::make<String>(static_cast<std::size_t>(stringLength));
   char *payload = NRef<String>(destination).data();
   copySourceToBuffer(source, payload, static_cast<std::size_t>(stringLength));
@@ -582,13 +650,20 @@ ParseStatus Default_Parser::parseIterative(ISource &source, Node &destination) {
     return makeSyntaxError("Unexpected end of source.");
   }
 
+  const bool recordRanges = recordingRanges(source);
   std::vector<ParserFrame> frameStack;
   frameStack.reserve(16);
   auto pushFrame = [&](ContainerType type) -> ParseStatus {
     if (frameStack.size() + 1 >= getMaxParserDepth()) {
       return makeSyntaxError("Maximum parser depth exceeded.");
     }
+    const bool onPath =
+        hashTap != nullptr && continuesHashPath(frameStack, options.hashPath);
     frameStack.emplace_back(type);
+    frameStack.back().onHashPath = onPath;
+    if (recordRanges) {
+      frameStack.back().sourceBegin = source.position() - 1;
+    }
     return ParseStatus::success();
   };
 
@@ -617,6 +692,12 @@ ParseStatus Default_Parser::parseIterative(ISource &source, Node &destination) {
       if (source.current() == ParserConstants::END) {
         source.next();
         Node completed = std::move(frame.container);
+        if (frame.hashTarget) {
+          pathDigest = hashTap->stop();
+        }
+        if (recordRanges) {
+          setSourceRange(completed, {frame.sourceBegin, source.position()});
+        }
         frameStack.pop_back();
         if (frameStack.empty()) {
           destination = std::move(completed);
@@ -659,12 +740,18 @@ ParseStatus Default_Parser::parseIterative(ISource &source, Node &destination) {
       if (!source.more()) {
         return makeSyntaxError("Unexpected end of source.");
       }
+      const bool target =
+          hashTap != nullptr && atHashTarget(frameStack, options.hashPath);
+      if (target) {
+        hashTap->start();
+      }
       if (source.current() == ParserConstants::DICTIONARY) {
         source.next();
         ParseStatus status = pushFrame(ContainerType::Dictionary);
         if (!status.ok()) {
           return status;
         }
+        frameStack.back().hashTarget = target;
         continue;
       }
       if (source.current() == ParserConstants::LIST) {
@@ -673,6 +760,7 @@ ParseStatus Default_Parser::parseIterative(ISource &source, Node &destination) {
         if (!status.ok()) {
           return status;
         }
+        frameStack.back().hashTarget = target;
         continue;
       }
       Node valueNode;
@@ -681,9 +769,11 @@ ParseStatus Default_Parser::parseIterative(ISource &source, Node &destination) {
       if (!status.ok()) {
         return status;
       }
+      if (target) {
+        pathDigest = hashTap->stop();
+      }
       NRef<Dictionary>(frame.container)
-          .appendSorted(Dictionary::Entry(std::move(frame.currentKey),
-                                          std::move(valueNode)));
+          .appendSorted(frame.takeEntry(std::move(valueNode)));
       frame.awaitingValue = false;
       continue;
     }
@@ -694,6 +784,12 @@ ParseStatus Default_Parser::parseIterative(ISource &source, Node &destination) {
     if (source.current() == ParserConstants::END) {
       source.next();
       Node completed = std::move(frame.container);
+      if (frame.hashTarget) {
+        pathDigest = hashTap->stop();
+      }
+      if (recordRanges) {
+        setSourceRange(completed, {frame.sourceBegin, source.position()});
+      }
       frameStack.pop_back();
       if (frameStack.empty()) {
         destination = std::move(completed);
@@ -706,16 +802,29 @@ ParseStatus Default_Parser::parseIterative(ISource &source, Node &destination) {
       }
       continue;
     }
-    ParseStatus status = parseStringKey(
-        source, static_cast<unsigned long>(frameStack.size() + 1),
-        frame.currentKey);
-    if (!status.ok()) {
-      return status;
-    }
-    if (frame.lastKey > frame.currentKey) {
-      return makeSyntaxError("Dictionary keys not in sequence.");
+    if (borrowing(source)) {
+      std::size_t length = 0;
+      if (ParseStatus status = scanStringLength(source, length);
+          !status.ok()) {
+        return status;
+      }
+      const std::string_view key = borrowPayload(source, length);
+      if (frame.lastBorrowedKey > key) {
+        return makeSyntaxError("Dictionary keys not in sequence.");
+      }
+      frame.lastBorrowedKey = frame.borrowedKey = key;
+    } else {
+      ParseStatus status = parseStringKey(
+          source, static_cast<unsigned long>(frameStack.size() + 1),
+          frame.currentKey);
+      if (!status.ok()) {
+        return status;
+      }
+      if (frame.lastKey > frame.currentKey) {
+        return makeSyntaxError("Dictionary keys not in sequence.");
+      }
+      frame.lastKey = frame.currentKey;
     }
-    frame.lastKey = frame.currentKey;
     frame.awaitingValue = true;
   }
 
@@ -767,7 +876,22 @@ ParseStatus Default_Parser::parseNodes(ISource &source,
 }
 
 ParseStatus Default_Parser::parseImpl(ISource &source, Node &destination) {
-  return parseIterative(source, destination);
+  pathDigest.clear();
+  hashTap = nullptr;
+  if (options.hash == HashAlgorithm::None) {
+    return parseIterative(source, destination);
+  }
+  HashingSource tap{source, options.hash};
+  hashTap = &tap;
+  if (options.hashPath.empty()) {
+    tap.start();
+  }
+  ParseStatus status = parseIterative(tap, destination);
+  if (options.hashPath.empty() && status.ok()) {
+    pathDigest = tap.stop();
+  }
+  hashTap = nullptr;
+  return status;
 }
 
 #endif
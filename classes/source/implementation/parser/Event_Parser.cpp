@@ -0,0 +1,207 @@
+// File: Event_Parser.cpp
+//
+// Description: Source implementation of the event driven Bencode parser.
+//
+
+#include "Event_Parser.hpp"
+#include "Default_Parser_Internal.hpp"
+
+namespace Bencode_Lib {
+
+static ParseStatus makeSyntaxError(const std::string_view &message) {
+  return ParseStatus::failure(ErrorCode::SyntaxError, std::string(message));
+}
+
+/// <summary>
+/// Open a list or dictionary frame, reusing any frame left at this depth.
+/// </summary>
+/// <param name="dictionary">true if the container is a dictionary.</param>
+/// <returns>Status of push.</returns>
+ParseStatus Event_Parser::pushFrame(const bool dictionary) {
+  if (depth + 1 >= Default_Parser::getMaxParserDepth()) {
+    return makeSyntaxError("Maximum parser depth exceeded.");
+  }
+  if (depth == frames.size()) {
+    frames.emplace_back();
+  }
+  Frame &frame = frames[depth++];
+  frame.dictionary = dictionary;
+  frame.hasKey = false;
+  frame.awaitingValue = false;
+  frame.lastKey.clear();
+  return ParseStatus::success();
+}
+/// <summary>
+/// Read the next dictionary key, check its order and raise its event.
+/// </summary>
+/// <param name="source">Reference to input interface used to parse Bencoded
+/// stream.</param> <param name="handler">Event handler.</param>
+/// <returns>Status of parse.</returns>
+ParseStatus Event_Parser::parseKey(ISource &source, IParseHandler &handler) {
+  std::size_t length = 0;
+  if (ParseStatus status = scanStringLength(source, length); !status.ok()) {
+    return status;
+  }
+  buffer.resize(length);
+  source.read(buffer.data(), buffer.size());
+  Frame &frame = frames[depth - 1];
+  if (frame.hasKey) {
+    if (frame.lastKey > buffer) {
+      return makeSyntaxError("Dictionary keys not in sequence.");
+    }
+    if (frame.lastKey == buffer) {
+      return makeSyntaxError("Duplicate dictionary key.");
+    }
+  }
+  std::swap(frame.lastKey, buffer);
+  frame.hasKey = true;
+  frame.awaitingValue = true;
+  handler.onKey(frame.lastKey);
+  return ParseStatus::success();
+}
+/// <summary>
+/// Read a string and raise its event; the payload is passed in place when
+/// the source holds it contiguously and copied to a reused buffer otherwise.
+/// </summary>
+/// <param name="source">Reference to input interface used to parse Bencoded
+/// stream.</param> <param name="handler">Event handler.</param>
+/// <returns>Status of parse.</returns>
+ParseStatus Event_Parser::parseString(ISource &source,
+                                      IParseHandler &handler) {
+  std::size_t length = 0;
+  if (ParseStatus status = scanStringLength(source, length); !status.ok()) {
+    return status;
+  }
+  if (const std::string_view payload = source.peek(length);
+      payload.size() == length) {
+    handler.onString(payload);
+    source.skip(length);
+  } else {
+    buffer.resize(length);
+    source.read(buffer.data(), buffer.size());
+    handler.onString(buffer);
+  }
+  return ParseStatus::success();
+}
+/// <summary>
+/// Iteratively parse the value at the source position raising events as
+/// each integer, string, key and container boundary is reached.
+/// </summary>
+/// <param name="source">Reference to input interface used to parse Bencoded
+/// stream.</param> <param name="handler">Event handler.</param>
+/// <returns>Status of parse.</returns>
+ParseStatus Event_Parser::parseEvents(ISource &source, IParseHandler &handler) {
+  depth = 0;
+  if (!source.more()) {
+    return makeSyntaxError("Unexpected end of source.");
+  }
+  if (Default_Parser::getMaxParserDepth() <= 1) {
+    return makeSyntaxError("Maximum parser depth exceeded.");
+  }
+  do {
+    if (depth > 0) {
+      if (!source.more()) {
+        return makeSyntaxError("Unexpected end of source.");
+      }
+      Frame &frame = frames[depth - 1];
+      if (!frame.awaitingValue && source.current() == ParserConstants::END) {
+        source.next();
+        --depth;
+        if (frame.dictionary) {
+          handler.onDictionaryEnd();
+        } else {
+          handler.onListEnd();
+        }
+        if (depth > 0) {
+          frames[depth - 1].awaitingValue = false;
+        }
+        continue;
+      }
+      if (frame.dictionary && !frame.awaitingValue) {
+        if (ParseStatus status = parseKey(source, handler); !status.ok()) {
+          return status;
+        }
+        continue;
+      }
+    }
+    switch (source.current()) {
+    case ParserConstants::DICTIONARY:
+    case ParserConstants::LIST: {
+      const bool dictionary = source.current() == ParserConstants::DICTIONARY;
+      if (ParseStatus status = pushFrame(dictionary); !status.ok()) {
+        return status;
+      }
+      source.next();
+      if (dictionary) {
+        handler.onDictionaryBegin();
+      } else {
+        handler.onListBegin();
+      }
+      continue;
+    }
+    case ParserConstants::INTEGER: {
+      source.next();
+      Bencode::IntegerType value = 0;
+      if (const IntegerScan scan = scanInteger(source, value);
+          scan != IntegerScan::Ok) {
+        return integerScanStatus(scan);
+      }
+      if (source.current() != ParserConstants::END) {
+        return ParseStatus::failure(ErrorCode::MissingEndTerminator,
+                                    "Missing end terminator on e");
+      }
+      source.next();
+      handler.onInteger(value);
+      break;
+    }
+    case ParserConstants::STRING_0:
+    case ParserConstants::STRING_1:
+    case ParserConstants::STRING_2:
+    case ParserConstants::STRING_3:
+    case ParserConstants::STRING_4:
+    case ParserConstants::STRING_5:
+    case ParserConstants::STRING_6:
+    case ParserConstants::STRING_7:
+    case ParserConstants::STRING_8:
+    case ParserConstants::STRING_9:
+    case ParserConstants::STRING_MINUS:
+    case ParserConstants::STRING_PLUS:
+      if (ParseStatus status = parseString(source, handler); !status.ok()) {
+        return status;
+      }
+      break;
+    default:
+      return makeSyntaxError(
+          depth == 0
+              ? "Expected integer, string, list or dictionary not present."
+              : "Expected integer or string while parsing container.");
+    }
+    if (depth > 0) {
+      frames[depth - 1].awaitingValue = false;
+    }
+  } while (depth > 0);
+  return ParseStatus::success();
+}
+
+#if BENCODE_ENABLE_EXCEPTIONS
+
+Event_Parser::ParseResultType Event_Parser::parse(ISource &source,
+                                                  IParseHandler &handler) {
+  throwOnFailure(parseEvents(source, handler));
+}
+
+#else
+
+Event_Parser::ParseResultType Event_Parser::parse(ISource &source,
+                                                  IParseHandler &handler) {
+  return parseEvents(source, handler);
+}
+
+#endif
+
+Event_Parser::ParseResultType Event_Parser::parse(ISource &&source,
+                                                  IParseHandler &handler) {
+  return parse(source, handler);
+}
+
+} // namespace Bencode_Lib
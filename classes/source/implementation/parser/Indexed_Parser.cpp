@@ -0,0 +1,382 @@
+// File: Indexed_Parser.cpp
+//
+// Description: Source implementation of the two pass (structural index then tree) Bencode parser.
+//
+
+#include "Indexed_Parser.hpp"
+#include "Default_Parser_Internal.hpp"
+
+#include <algorithm>
+#include <limits>
+#if !BENCODE_EMBEDDED_MODE
+#include <atomic>
+#include <thread>
+#endif
+
+namespace Bencode_Lib {
+
+namespace {
+
+// Container being built by stage two; keys are views into the document
+struct IndexedFrame {
+  Node container;
+  bool isList;
+  std::string_view lastKey{};
+  bool hasKey = false;
+  bool awaitingValue = false;
+};
+
+#if !BENCODE_EMBEDDED_MODE
+// Joins the workers started so far when it goes out of scope, so that a
+// std::thread constructor throwing part way through filling a pool does
+// not destroy joinable threads (std::terminate)
+struct PoolJoiner {
+  std::vector<std::thread> &pool;
+  ~PoolJoiner() {
+    for (std::thread &thread : pool) {
+      if (thread.joinable()) {
+        thread.join();
+      }
+    }
+  }
+};
+#endif
+
+} // namespace
+
+Indexed_Parser::Indexed_Parser(const unsigned int threads)
+    : threads(threads) {
+#if !BENCODE_EMBEDDED_MODE
+  if (this->threads == 0) {
+    this->threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+#endif
+}
+/// <summary>
+/// Stage one: walk the value at the start of a document recording the position
+/// of every structural token. Digit runs are scanned a word at a time and
+/// string payloads are jumped using their decoded lengths.
+/// </summary>
+/// <param name="document">Contiguous Bencode input.</param>
+/// <param name="index">Structural index (cleared first).</param>
+/// <returns>Number of bytes spanned by the value or zero if the document
+/// cannot be indexed.</returns>
+std::size_t Indexed_Parser::buildIndex(const std::string_view &document,
+                                       std::vector<Token> &index) {
+  index.clear();
+  const unsigned long maxParserDepth = Default_Parser::getMaxParserDepth();
+  if (maxParserDepth <= 1) {
+    return 0;
+  }
+  const char *data = document.data();
+  const std::size_t size = document.size();
+  std::size_t position = 0;
+  unsigned long depth = 0;
+  do {
+    if (position >= size) {
+      return 0;
+    }
+    switch (data[position]) {
+    case ParserConstants::DICTIONARY:
+    case ParserConstants::LIST:
+      if (depth + 1 >= maxParserDepth) {
+        return 0;
+      }
+      index.push_back({data[position] == ParserConstants::DICTIONARY
+                           ? Token::Kind::Dictionary
+                           : Token::Kind::List,
+                       position, 0});
+      ++depth;
+      ++position;
+      break;
+    case ParserConstants::END:
+      if (depth == 0) {
+        return 0;
+      }
+      index.push_back({Token::Kind::End, position, 0});
+      --depth;
+      ++position;
+      break;
+    case ParserConstants::INTEGER: {
+      const std::size_t start = position + 1;
+      std::size_t length =
+          start < size && data[start] == ParserConstants::STRING_MINUS ? 1 : 0;
+      length += countDigits(data + start + length, size - start - length);
+      const std::size_t end = start + length;
+      if (end >= size || data[end] != ParserConstants::END) {
+        return 0;
+      }
+      index.push_back({Token::Kind::Integer, start, length});
+      position = end + 1;
+      break;
+    }
+    case ParserConstants::STRING_0:
+    case ParserConstants::STRING_1:
+    case ParserConstants::STRING_2:
+    case ParserConstants::STRING_3:
+    case ParserConstants::STRING_4:
+    case ParserConstants::STRING_5:
+    case ParserConstants::STRING_6:
+    case ParserConstants::STRING_7:
+    case ParserConstants::STRING_8:
+    case ParserConstants::STRING_9: {
+      const std::size_t length = countDigits(data + position, size - position);
+      const std::size_t colon = position + length;
+      Bencode::IntegerType stringLength = 0;
+      if (length > IntegerDigitBuffer{}.size() || colon >= size ||
+          data[colon] != ParserConstants::COLON ||
+          convertIntegerDigits(data + position, length, stringLength) !=
+              IntegerScan::Ok ||
+          static_cast<uint64_t>(stringLength) > String::getMaxStringLength() ||
+          static_cast<uint64_t>(stringLength) > size - colon - 1) {
+        return 0;
+      }
+      index.push_back({Token::Kind::String, colon + 1,
+                       static_cast<std::size_t>(stringLength)});
+      position = colon + 1 + static_cast<std::size_t>(stringLength);
+      break;
+    }
+    default:
+      return 0;
+    }
+  } while (depth > 0);
+  return position;
+}
+/// <summary>
+/// Stage two: build the Node tree from a structural index. Integer conversion
+/// and dictionary key order are checked here.
+/// </summary>
+/// <param name="document">Contiguous Bencode input that was indexed.</param>
+/// <param name="index">Structural index of the document.</param>
+/// <param name="destination">Root Node of the tree built.</param>
+/// <returns>true if the tree was built, false if the input needs the default
+/// parser to report an error.</returns>
+bool Indexed_Parser::buildTree(const std::string_view &document,
+                               const std::span<const Token> index,
+                               Node &destination) {
+  std::vector<IndexedFrame> frameStack;
+  frameStack.reserve(16);
+  Node value;
+  for (const Token &token : index) {
+    if (!frameStack.empty() && !frameStack.back().isList &&
+        !frameStack.back().awaitingValue) {
+      IndexedFrame &frame = frameStack.back();
+      if (token.kind == Token::Kind::String) {
+        const std::string_view key = document.substr(token.offset, token.length);
+        if (frame.hasKey && frame.lastKey >= key) {
+          return false;
+        }
+        frame.lastKey = key;
+        frame.hasKey = true;
+        frame.awaitingValue = true;
+        continue;
+      }
+      if (token.kind != Token::Kind::End) {
+        return false;
+      }
+    }
+    // A dictionary may not end between a key and its value
+    if (token.kind == Token::Kind::End && !frameStack.empty() &&
+        !frameStack.back().isList && frameStack.back().awaitingValue) {
+      return false;
+    }
+    switch (token.kind) {
+    case Token::Kind::Dictionary:
+      frameStack.push_back({Node::make<Dictionary>(), false});
+      continue;
+    case Token::Kind::List:
+      frameStack.push_back({Node::make<List>(), true});
+      continue;
+    case Token::Kind::End:
+      value = std::move(frameStack.back().container);
+      frameStack.pop_back();
+      break;
+    case Token::Kind::Integer: {
+      Bencode::IntegerType integer = 0;
+      if (token.length > IntegerDigitBuffer{}.size() ||
+          convertIntegerDigits(document.data() + token.offset, token.length,
+                               integer) != IntegerScan::Ok) {
+        return false;
+      }
+      value = Node::make<Integer>(integer);
+      break;
+    }
+    case Token::Kind::String:
+    default:
+      value = token.length == 0 ? Node::make<String>()
+                                : Node::make<String>(document.substr(
+                                      token.offset, token.length));
+      break;
+    }
+    if (frameStack.empty()) {
+      destination = std::move(value);
+      return true;
+    }
+    IndexedFrame &parent = frameStack.back();
+    if (parent.isList) {
+      NRef<List>(parent.container).add(std::move(value));
+    } else {
+      NRef<Dictionary>(parent.container)
+          .appendSorted(
+              Dictionary::Entry(parent.lastKey, std::move(value)));
+      parent.awaitingValue = false;
+    }
+  }
+  return false;
+}
+/// <summary>
+/// Stage two split across threads: the elements of the outermost container
+/// are found from the index, built into subtrees by worker threads and then
+/// added to the root in order, checking dictionary key order as they go.
+/// </summary>
+/// <param name="document">Contiguous Bencode input that was indexed.</param>
+/// <param name="destination">Root Node of the tree built.</param>
+/// <returns>true if the tree was built, false if the input needs the default
+/// parser to report an error.</returns>
+bool Indexed_Parser::buildParallel(const std::string_view &document,
+                                   Node &destination) const {
+#if BENCODE_EMBEDDED_MODE
+  return buildTree(document, tokens, destination);
+#else
+  const Token::Kind rootKind = tokens.front().kind;
+  if (rootKind != Token::Kind::List && rootKind != Token::Kind::Dictionary) {
+    return buildTree(document, tokens, destination);
+  }
+  const bool isList = rootKind == Token::Kind::List;
+  // First token of each element (the key for a dictionary)
+  std::vector<std::size_t> elements;
+  std::size_t items = 0;
+  unsigned long depth = 0;
+  for (std::size_t index = 1; index + 1 < tokens.size(); ++index) {
+    if (depth == 0 && (isList || items++ % 2 == 0)) {
+      elements.push_back(index);
+    }
+    if (tokens[index].kind == Token::Kind::Dictionary ||
+        tokens[index].kind == Token::Kind::List) {
+      ++depth;
+    } else if (tokens[index].kind == Token::Kind::End) {
+      --depth;
+    }
+  }
+  // An odd item count is a root dictionary key without a value, which the
+  // serial build rejects
+  if (elements.size() < kMinParallelElements || items % 2 != 0) {
+    return buildTree(document, tokens, destination);
+  }
+  const std::size_t count = elements.size();
+  elements.push_back(tokens.size() - 1);
+  std::vector<Node> values(count);
+  std::atomic<bool> failed{false};
+  auto buildElements = [&](const std::size_t first, const std::size_t last) {
+#if BENCODE_ENABLE_EXCEPTIONS
+    try {
+#endif
+      for (std::size_t element = first; element < last && !failed; ++element) {
+        const std::size_t start = elements[element] + (isList ? 0 : 1);
+        if (!buildTree(document,
+                       std::span(tokens).subspan(
+                           start, elements[element + 1] - start),
+                       values[element])) {
+          failed = true;
+        }
+      }
+#if BENCODE_ENABLE_EXCEPTIONS
+    } catch (...) {
+      failed = true;
+    }
+#endif
+  };
+  const std::size_t workers =
+      std::min<std::size_t>(threads, count / (kMinParallelElements / 4));
+  std::vector<std::thread> pool;
+  pool.reserve(workers - 1);
+  {
+    const PoolJoiner joiner{pool};
+    for (std::size_t worker = 1; worker < workers; ++worker) {
+      pool.emplace_back(buildElements, count * worker / workers,
+                        count * (worker + 1) / workers);
+    }
+    buildElements(0, count / workers);
+  }
+  if (failed) {
+    return false;
+  }
+  if (isList) {
+    destination = Node::make<List>();
+    auto &list = NRef<List>(destination);
+    for (Node &value : values) {
+      list.add(std::move(value));
+    }
+    return true;
+  }
+  Node root = Node::make<Dictionary>();
+  auto &dictionary = NRef<Dictionary>(root);
+  std::string_view lastKey;
+  for (std::size_t element = 0; element < count; ++element) {
+    const Token &token = tokens[elements[element]];
+    if (token.kind != Token::Kind::String) {
+      return false;
+    }
+    const std::string_view key = document.substr(token.offset, token.length);
+    if (element > 0 && lastKey >= key) {
+      return false;
+    }
+    dictionary.appendSorted(
+        Dictionary::Entry(key, std::move(values[element])));
+    lastKey = key;
+  }
+  destination = std::move(root);
+  return true;
+#endif
+}
+/// <summary>
+/// Parse the value at the current source position through the structural
+/// index, consuming it from the source on success.
+/// </summary>
+/// <param name="source">Reference to input interface used to parse Bencoded
+/// stream.</param> <param name="destination">Root Node parsed.</param>
+/// <returns>false (source untouched) if the default parser must be used.
+/// </returns>
+bool Indexed_Parser::parseIndexed(ISource &source, Node &destination) {
+  // Buffered sources would have to read the rest of their input into memory
+  if (!source.contiguous()) {
+    return false;
+  }
+  const std::string_view document =
+      source.peek(std::numeric_limits<std::size_t>::max());
+  if (document.empty()) {
+    return false;
+  }
+  const std::size_t consumed = buildIndex(document, tokens);
+  if (consumed == 0 ||
+      !(threads > 1 ? buildParallel(document, destination)
+                    : buildTree(document, tokens, destination))) {
+    return false;
+  }
+  source.skip(consumed);
+  return true;
+}
+
+#if BENCODE_ENABLE_EXCEPTIONS
+
+Node Indexed_Parser::parseImpl(ISource &source) {
+  if (Node root; parseIndexed(source, root)) {
+    return root;
+  }
+  Default_Parser fallback;
+  return fallback.parse(source);
+}
+
+#else
+
+ParseStatus Indexed_Parser::parseImpl(ISource &source, Node &destination) {
+  if (parseIndexed(source, destination)) {
+    return ParseStatus::success();
+  }
+  Default_Parser fallback;
+  return fallback.parse(source, destination);
+}
+
+#endif
+
+} // namespace Bencode_Lib
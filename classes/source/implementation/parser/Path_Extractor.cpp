@@ -0,0 +1,276 @@
+// File: Path_Extractor.cpp
+//
+// Description: Source implementation of the on-demand key path extractor.
+//
+
+#include "Path_Extractor.hpp"
+#include "Default_Parser_Internal.hpp"
+
+#include <bit>
+
+namespace Bencode_Lib {
+
+static ParseStatus makeSyntaxError(const std::string_view &message) {
+  return ParseStatus::failure(ErrorCode::SyntaxError, std::string(message));
+}
+
+static std::uint64_t pathBit(const std::size_t path) {
+  return std::uint64_t{1} << path;
+}
+
+Path_Extractor::Path_Extractor(const std::vector<Path> &keyPaths)
+    : paths(keyPaths) {
+  if (paths.size() > kMaxPaths) {
+    throw Error("Too many key paths.");
+  }
+  key.reserve(64);
+}
+
+Path_Extractor::Path_Extractor(
+    const std::initializer_list<std::string_view> keyPaths,
+    const char separator) {
+  if (keyPaths.size() > kMaxPaths) {
+    throw Error("Too many key paths.");
+  }
+  for (const std::string_view keyPath : keyPaths) {
+    Path path;
+    if (!keyPath.empty()) {
+      std::size_t start = 0;
+      for (std::size_t end = keyPath.find(separator);
+           end != std::string_view::npos;
+           start = end + 1, end = keyPath.find(separator, start)) {
+        path.emplace_back(keyPath.substr(start, end - start));
+      }
+      path.emplace_back(keyPath.substr(start));
+    }
+    paths.push_back(std::move(path));
+  }
+  key.reserve(64);
+}
+
+const Node &Path_Extractor::operator[](const std::size_t path) const {
+  if (!found(path)) {
+    throw Error("No value found for key path.");
+  }
+  return *results[path];
+}
+/// <summary>
+/// Read a dictionary key into the reusable key buffer.
+/// </summary>
+/// <param name="source">Reference to input interface used to parse Bencoded
+/// stream.</param> <returns>Status of read.</returns>
+ParseStatus Path_Extractor::readKey(ISource &source) {
+  std::size_t length = 0;
+  if (ParseStatus status = scanStringLength(source, length); !status.ok()) {
+    return status;
+  }
+  key.resize(length);
+  source.read(key.data(), key.size());
+  return ParseStatus::success();
+}
+/// <summary>
+/// Move the source past the value at its current position without decoding
+/// it; string payloads are skipped using their length prefixes.
+/// </summary>
+/// <param name="source">Reference to input interface used to parse Bencoded
+/// stream.</param> <returns>Status of skip.</returns>
+ParseStatus Path_Extractor::skipValue(ISource &source) {
+  std::size_t depth = 0;
+  do {
+    if (!source.more()) {
+      return makeSyntaxError("Unexpected end of source.");
+    }
+    switch (source.current()) {
+    case ParserConstants::DICTIONARY:
+    case ParserConstants::LIST:
+      source.next();
+      ++depth;
+      break;
+    case ParserConstants::END:
+      if (depth == 0) {
+        return makeSyntaxError(
+            "Expected integer, string, list or dictionary not present.");
+      }
+      source.next();
+      --depth;
+      break;
+    case ParserConstants::INTEGER: {
+      source.next();
+      Bencode::IntegerType integer = 0;
+      if (const IntegerScan scan = scanInteger(source, integer);
+          scan != IntegerScan::Ok) {
+        return integerScanStatus(scan);
+      }
+      if (source.current() != ParserConstants::END) {
+        return ParseStatus::failure(ErrorCode::MissingEndTerminator,
+                                    "Missing end terminator on e");
+      }
+      source.next();
+      break;
+    }
+    case ParserConstants::STRING_0:
+    case ParserConstants::STRING_1:
+    case ParserConstants::STRING_2:
+    case ParserConstants::STRING_3:
+    case ParserConstants::STRING_4:
+    case ParserConstants::STRING_5:
+    case ParserConstants::STRING_6:
+    case ParserConstants::STRING_7:
+    case ParserConstants::STRING_8:
+    case ParserConstants::STRING_9:
+    case ParserConstants::STRING_MINUS:
+    case ParserConstants::STRING_PLUS: {
+      Bencode::IntegerType length = 0;
+      if (const IntegerScan scan = scanInteger(source, length);
+          scan != IntegerScan::Ok) {
+        return integerScanStatus(scan);
+      }
+      if (length < 0) {
+        return makeSyntaxError("Negative string length.");
+      }
+      if (source.current() != ParserConstants::COLON) {
+        return makeSyntaxError("Missing colon separator in string value.");
+      }
+      source.next();
+      source.skip(static_cast<std::size_t>(length));
+      break;
+    }
+    default:
+      return makeSyntaxError(
+          "Expected integer, string, list or dictionary not present.");
+    }
+  } while (depth > 0);
+  return ParseStatus::success();
+}
+/// <summary>
+/// Materialize the value at the source position for the paths ending at this
+/// level; paths continuing below it are resolved inside the value.
+/// </summary>
+/// <param name="source">Reference to input interface used to parse Bencoded
+/// stream.</param> <param name="active">Paths matched so far.</param>
+/// <param name="level">Number of keys matched.</param>
+/// <returns>Status of parse.</returns>
+ParseStatus Path_Extractor::materialize(ISource &source,
+                                        const std::uint64_t active,
+                                        const std::size_t level) {
+  std::size_t owner = 0;
+  for (std::uint64_t mask = active; mask != 0; mask &= mask - 1) {
+    owner = static_cast<std::size_t>(std::countr_zero(mask));
+    if (paths[owner].size() == level) {
+      break;
+    }
+  }
+  Default_Parser parser;
+#if BENCODE_ENABLE_EXCEPTIONS
+  values[owner] = parser.parse(source);
+#else
+  if (ParseStatus status = parser.parse(source, values[owner]); !status.ok()) {
+    return status;
+  }
+#endif
+  for (std::uint64_t mask = active; mask != 0; mask &= mask - 1) {
+    const auto path = static_cast<std::size_t>(std::countr_zero(mask));
+    const Node *value = &values[owner];
+    for (std::size_t index = level; value != nullptr && index < paths[path].size();
+         ++index) {
+      if (isA<Dictionary>(*value) &&
+          NRef<Dictionary>(*value).contains(paths[path][index])) {
+        value = &(*value)[paths[path][index]];
+      } else {
+        value = nullptr;
+      }
+    }
+    results[path] = value;
+  }
+  pending &= ~active;
+  return ParseStatus::success();
+}
+/// <summary>
+/// Follow the active paths through the value at the source position,
+/// skipping every dictionary entry that none of them needs.
+/// </summary>
+/// <param name="source">Reference to input interface used to parse Bencoded
+/// stream.</param> <param name="active">Paths matched so far.</param>
+/// <param name="level">Number of keys matched.</param>
+/// <returns>Status of walk.</returns>
+ParseStatus Path_Extractor::walk(ISource &source, const std::uint64_t active,
+                                 const std::size_t level) {
+  for (std::uint64_t mask = active; mask != 0; mask &= mask - 1) {
+    if (paths[static_cast<std::size_t>(std::countr_zero(mask))].size() ==
+        level) {
+      return materialize(source, active, level);
+    }
+  }
+  if (!source.more()) {
+    return makeSyntaxError("Unexpected end of source.");
+  }
+  if (source.current() != ParserConstants::DICTIONARY) {
+    pending &= ~active;
+    return pending == 0 ? ParseStatus::success() : skipValue(source);
+  }
+  source.next();
+  while (source.more() && source.current() != ParserConstants::END) {
+    if (ParseStatus status = readKey(source); !status.ok()) {
+      return status;
+    }
+    std::uint64_t matching = 0;
+    for (std::uint64_t mask = active & pending; mask != 0; mask &= mask - 1) {
+      const auto path = static_cast<std::size_t>(std::countr_zero(mask));
+      if (paths[path][level] == key) {
+        matching |= pathBit(path);
+      } else if (paths[path][level] < key) {
+        // Keys are sorted so this one can no longer appear
+        pending &= ~pathBit(path);
+      }
+    }
+    if (pending == 0) {
+      return ParseStatus::success();
+    }
+    if (ParseStatus status = matching != 0 ? walk(source, matching, level + 1)
+                                           : skipValue(source);
+        !status.ok() || pending == 0) {
+      return status;
+    }
+  }
+  if (source.current() != ParserConstants::END) {
+    return ParseStatus::failure(ErrorCode::MissingEndTerminator,
+                                "Missing end terminator on e");
+  }
+  source.next();
+  pending &= ~active;
+  return ParseStatus::success();
+}
+
+#if BENCODE_ENABLE_EXCEPTIONS
+
+Path_Extractor::ParseResultType Path_Extractor::extract(ISource &source) {
+  values = std::vector<Node>(paths.size());
+  results.assign(paths.size(), nullptr);
+  pending = paths.size() == kMaxPaths ? ~std::uint64_t{0}
+                                      : pathBit(paths.size()) - 1;
+  if (pending == 0) {
+    return;
+  }
+  throwOnFailure(walk(source, pending, 0));
+}
+
+#else
+
+Path_Extractor::ParseResultType Path_Extractor::extract(ISource &source) {
+  values = std::vector<Node>(paths.size());
+  results.assign(paths.size(), nullptr);
+  pending = paths.size() == kMaxPaths ? ~std::uint64_t{0}
+                                      : pathBit(paths.size()) - 1;
+  if (pending == 0) {
+    return ParseStatus::success();
+  }
+  return walk(source, pending, 0);
+}
+
+#endif
+
+Path_Extractor::ParseResultType Path_Extractor::extract(ISource &&source) {
+  return extract(source);
+}
+
+} // namespace Bencode_Lib
@@ -0,0 +1,280 @@
+// File: Push_Parser.cpp
+//
+// Description: Source implementation of the resumable Bencode parser.
+//
+
+#include "Push_Parser.hpp"
+#include "Default_Parser_Internal.hpp"
+
+#include <algorithm>
+
+namespace Bencode_Lib {
+
+static ParseStatus makeSyntaxError(const std::string_view &message) {
+  return ParseStatus::failure(ErrorCode::SyntaxError, std::string(message));
+}
+
+Push_Parser::Push_Parser() = default;
+Push_Parser::Push_Parser(Push_Parser &&other) noexcept = default;
+Push_Parser &Push_Parser::operator=(Push_Parser &&other) noexcept = default;
+Push_Parser::~Push_Parser() = default;
+
+Node Push_Parser::take() {
+  if (!complete()) {
+    throw Error("No complete value to take.");
+  }
+  state = State::Element;
+  return std::move(value);
+}
+
+void Push_Parser::reset() {
+  frames.clear();
+  state = State::Element;
+  digitCount = 0;
+  readingKey = false;
+  stringNode = Node{};
+  payloadLength = 0;
+  payloadRead = 0;
+  value = Node{};
+}
+/// <summary>
+/// Open a list or dictionary frame.
+/// </summary>
+/// <param name="dictionary">true if the container is a dictionary.</param>
+/// <returns>Status of push.</returns>
+ParseStatus Push_Parser::pushFrame(const bool dictionary) {
+  if (frames.size() + 1 >= Default_Parser::getMaxParserDepth()) {
+    return makeSyntaxError("Maximum parser depth exceeded.");
+  }
+  frames.emplace_back(dictionary ? ContainerType::Dictionary
+                                 : ContainerType::List);
+  return ParseStatus::success();
+}
+/// <summary>
+/// Add a finished value to the open container, or hold it as the completed
+/// value if no container is open.
+/// </summary>
+/// <param name="completed">Finished value.</param>
+/// <returns>Status of add.</returns>
+ParseStatus Push_Parser::completeValue(Node &&completed) {
+  if (frames.empty()) {
+    value = std::move(completed);
+    state = State::Complete;
+    return ParseStatus::success();
+  }
+  state = State::Element;
+  return attachCompletedValue(frames.back(), std::move(completed));
+}
+/// <summary>
+/// Start the next element from its first character: a value, a dictionary
+/// key or the end of the open container.
+/// </summary>
+/// <param name="current">First character of element.</param>
+/// <returns>Status of parse.</returns>
+ParseStatus Push_Parser::startElement(const char current) {
+  if (frames.empty()) {
+    if (Default_Parser::getMaxParserDepth() <= 1) {
+      return makeSyntaxError("Maximum parser depth exceeded.");
+    }
+  } else {
+    ParserFrame &frame = frames.back();
+    if (!frame.awaitingValue && current == ParserConstants::END) {
+      ++used;
+      Node completed = std::move(frame.container);
+      frames.pop_back();
+      return completeValue(std::move(completed));
+    }
+    if (frame.type == ContainerType::Dictionary && !frame.awaitingValue) {
+      readingKey = true;
+      digitCount = 0;
+      state = State::Length;
+      return ParseStatus::success();
+    }
+  }
+  switch (current) {
+  case ParserConstants::DICTIONARY:
+  case ParserConstants::LIST:
+    ++used;
+    return pushFrame(current == ParserConstants::DICTIONARY);
+  case ParserConstants::INTEGER:
+    ++used;
+    digitCount = 0;
+    state = State::Integer;
+    return ParseStatus::success();
+  case ParserConstants::STRING_0:
+  case ParserConstants::STRING_1:
+  case ParserConstants::STRING_2:
+  case ParserConstants::STRING_3:
+  case ParserConstants::STRING_4:
+  case ParserConstants::STRING_5:
+  case ParserConstants::STRING_6:
+  case ParserConstants::STRING_7:
+  case ParserConstants::STRING_8:
+  case ParserConstants::STRING_9:
+  case ParserConstants::STRING_MINUS:
+  case ParserConstants::STRING_PLUS:
+    readingKey = false;
+    digitCount = 0;
+    state = State::Length;
+    return ParseStatus::success();
+  default:
+    return makeSyntaxError(
+        frames.empty()
+            ? "Expected integer, string, list or dictionary not present."
+            : "Expected integer or string while parsing container.");
+  }
+}
+/// <summary>
+/// Add a character to the partial integer or string length; the first
+/// character that cannot belong to it ends it.
+/// </summary>
+/// <param name="current">Next character.</param>
+/// <returns>Status of parse.</returns>
+ParseStatus Push_Parser::addDigit(const char current) {
+  if (std::isdigit(current) != 0 ||
+      (digitCount == 0 && current == ParserConstants::STRING_MINUS)) {
+    // Number too large to fit in buffer
+    if (digitCount == digits.size()) {
+      return integerScanStatus(IntegerScan::TooLarge);
+    }
+    digits[digitCount++] = current;
+    ++used;
+    return ParseStatus::success();
+  }
+  return state == State::Integer ? endInteger(current) : endLength(current);
+}
+/// <summary>
+/// Convert the integer digits and confirm its end terminator.
+/// </summary>
+/// <param name="current">Character after the digits.</param>
+/// <returns>Status of parse.</returns>
+ParseStatus Push_Parser::endInteger(const char current) {
+  Bencode::IntegerType integer = 0;
+  if (const IntegerScan scan =
+          convertIntegerDigits(digits.data(), digitCount, integer);
+      scan != IntegerScan::Ok) {
+    return integerScanStatus(scan);
+  }
+  if (current != ParserConstants::END) {
+    return ParseStatus::failure(ErrorCode::MissingEndTerminator,
+                                "Missing end terminator on e");
+  }
+  ++used;
+  return completeValue(Node::make<Integer>(integer));
+}
+/// <summary>
+/// Convert the string length, confirm its ':' separator and size the
+/// destination for the payload.
+/// </summary>
+/// <param name="current">Character after the digits.</param>
+/// <returns>Status of parse.</returns>
+ParseStatus Push_Parser::endLength(const char current) {
+  Bencode::IntegerType length = 0;
+  if (const IntegerScan scan =
+          convertIntegerDigits(digits.data(), digitCount, length);
+      scan != IntegerScan::Ok) {
+    return integerScanStatus(scan);
+  }
+  if (length < 0) {
+    return makeSyntaxError("Negative string length.");
+  }
+  if (current != ParserConstants::COLON) {
+    return makeSyntaxError("Missing colon separator in string value.");
+  }
+  ++used;
+  if (static_cast<uint64_t>(length) > String::getMaxStringLength()) {
+    return makeSyntaxError("String size exceeds maximum allowed size.");
+  }
+  payloadLength = static_cast<std::size_t>(length);
+  payloadRead = 0;
+  if (readingKey) {
+    frames.back().currentKey.resize(payloadLength);
+  } else if (payloadLength == 0) {
+    stringNode = Node::make<String>();
+  } else {
+    stringNode = Node::make<String>(payloadLength);
+  }
+  state = State::Payload;
+  return payloadLength == 0 ? endPayload() : ParseStatus::success();
+}
+/// <summary>
+/// Finish a string payload: check a key's order in its dictionary or add a
+/// string value.
+/// </summary>
+/// <returns>Status of parse.</returns>
+ParseStatus Push_Parser::endPayload() {
+  if (!readingKey) {
+    return completeValue(std::move(stringNode));
+  }
+  readingKey = false;
+  ParserFrame &frame = frames.back();
+  if (NRef<Dictionary>(frame.container).size() > 0) {
+    if (frame.lastKey > frame.currentKey) {
+      return makeSyntaxError("Dictionary keys not in sequence.");
+    }
+    if (frame.lastKey == frame.currentKey) {
+      return makeSyntaxError("Duplicate dictionary key.");
+    }
+  }
+  frame.lastKey = frame.currentKey;
+  frame.awaitingValue = true;
+  state = State::Element;
+  return ParseStatus::success();
+}
+/// <summary>
+/// Run the chunk through the parser state machine; string payloads are
+/// copied in bulk, everything else a character at a time.
+/// </summary>
+/// <param name="chunk">Next input bytes.</param>
+/// <returns>Status of parse.</returns>
+ParseStatus Push_Parser::advance(const std::string_view chunk) {
+  used = 0;
+  while (used < chunk.size() && state != State::Complete) {
+    ParseStatus status = ParseStatus::success();
+    switch (state) {
+    case State::Element:
+      status = startElement(chunk[used]);
+      break;
+    case State::Integer:
+    case State::Length:
+      status = addDigit(chunk[used]);
+      break;
+    case State::Payload: {
+      const std::size_t count =
+          std::min(payloadLength - payloadRead, chunk.size() - used);
+      char *payload = readingKey ? frames.back().currentKey.data()
+                                 : NRef<String>(stringNode).data();
+      std::memcpy(payload + payloadRead, chunk.data() + used, count);
+      payloadRead += count;
+      used += count;
+      if (payloadRead == payloadLength) {
+        status = endPayload();
+      }
+      break;
+    }
+    default:
+      break;
+    }
+    if (!status.ok()) {
+      reset();
+      return status;
+    }
+  }
+  return ParseStatus::success();
+}
+
+#if BENCODE_ENABLE_EXCEPTIONS
+
+Push_Parser::ParseResultType Push_Parser::feed(const std::string_view chunk) {
+  throwOnFailure(advance(chunk));
+}
+
+#else
+
+Push_Parser::ParseResultType Push_Parser::feed(const std::string_view chunk) {
+  return advance(chunk);
+}
+
+#endif
+
+} // namespace Bencode_Lib
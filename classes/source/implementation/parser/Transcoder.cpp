@@ -0,0 +1,355 @@
+// File: Transcoder.cpp
+//
+// Description: Source implementation of the single pass Bencode to JSON/XML/YAML converter.
+//
+
+#include "Transcoder.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Bencode_Lib {
+
+namespace {
+
+// Open containers are kept in a vector indexed by depth that is never
+// shrunk, so buffers held per level are reused by later containers
+template <typename Level> class LevelStack {
+public:
+  Level &push() {
+    if (depth == levels.size()) {
+      levels.emplace_back();
+    }
+    return levels[depth++];
+  }
+  void pop() { --depth; }
+  [[nodiscard]] bool empty() const { return depth == 0; }
+  [[nodiscard]] Level &top() { return levels[depth - 1]; }
+
+private:
+  std::vector<Level> levels;
+  std::size_t depth = 0;
+};
+
+class JSON_Handler final : public IParseHandler {
+public:
+  JSON_Handler(IDestination &destination, const ITranslator &translator,
+               const BinaryEncoding binary)
+      : destination(destination), translator(translator), binary(binary) {}
+
+  void onInteger(const std::int64_t value) override {
+    beforeValue();
+    destination.add(IntegerFormat{value}.view());
+  }
+  void onString(const std::string_view value) override {
+    beforeValue();
+    if (encodeAsBinary(value, binary)) {
+      destination.add(binary == BinaryEncoding::Hex ? R"({"hex" : ")"
+                                                    : R"({"base64" : ")");
+      addBinary(value, binary, destination);
+      destination.add("\"}");
+      return;
+    }
+    destination.add('"');
+    translator.to(value, destination);
+    destination.add('"');
+  }
+  void onListBegin() override { open('[', false); }
+  void onListEnd() override { close(']'); }
+  void onDictionaryBegin() override { open('{', true); }
+  void onDictionaryEnd() override { close('}'); }
+  void onKey(const std::string_view key) override {
+    Level &level = stack.top();
+    if (!level.empty) {
+      destination.add(',');
+    }
+    level.empty = false;
+    destination.add('"');
+    destination.add(key);
+    destination.add("\" : ");
+  }
+
+private:
+  struct Level {
+    bool dictionary = false;
+    bool empty = true;
+  };
+  // List elements after the first are separated by commas
+  void beforeValue() {
+    if (stack.empty() || stack.top().dictionary) {
+      return;
+    }
+    if (!stack.top().empty) {
+      destination.add(',');
+    }
+    stack.top().empty = false;
+  }
+  void open(const char start, const bool dictionary) {
+    beforeValue();
+    destination.add(start);
+    Level &level = stack.push();
+    level.dictionary = dictionary;
+    level.empty = true;
+  }
+  void close(const char end) {
+    stack.pop();
+    destination.add(end);
+  }
+
+  IDestination &destination;
+  const ITranslator &translator;
+  BinaryEncoding binary;
+  LevelStack<Level> stack;
+};
+
+class XML_Handler final : public IParseHandler {
+public:
+  XML_Handler(IDestination &destination, const ITranslator &translator,
+              const BinaryEncoding binary)
+      : destination(destination), translator(translator), binary(binary) {}
+
+  void onInteger(const std::int64_t value) override {
+    beforeValue();
+    destination.add(IntegerFormat{value}.view());
+    afterValue();
+  }
+  void onString(const std::string_view value) override {
+    beforeValue();
+    if (encodeAsBinary(value, binary, kXMLEscapeGrowth)) {
+      const bool hex = binary == BinaryEncoding::Hex;
+      destination.add(hex ? "<Hex>" : "<Base64>");
+      addBinary(value, binary, destination);
+      destination.add(hex ? "</Hex>" : "</Base64>");
+    } else {
+      translator.to(value, destination);
+    }
+    afterValue();
+  }
+  void onListBegin() override { open(false); }
+  void onListEnd() override {
+    if (stack.top().values == 0) {
+      destination.add("<Row></Row>");
+    }
+    stack.pop();
+    afterValue();
+  }
+  void onDictionaryBegin() override { open(true); }
+  void onDictionaryEnd() override {
+    stack.pop();
+    afterValue();
+  }
+  void onKey(const std::string_view key) override {
+    // Kept for the closing tag written once the value is complete
+    stack.top().key.assign(key);
+    destination.add('<');
+    XML_Stringify::addElementName(key, destination);
+    destination.add('>');
+  }
+
+private:
+  struct Level {
+    bool dictionary = false;
+    std::size_t values = 0;
+    std::string key{};
+  };
+  void beforeValue() {
+    if (!stack.empty() && !stack.top().dictionary) {
+      ++stack.top().values;
+      destination.add("<Row>");
+    }
+  }
+  void afterValue() {
+    if (stack.empty()) {
+      return;
+    }
+    if (stack.top().dictionary) {
+      destination.add("</");
+      XML_Stringify::addElementName(stack.top().key, destination);
+      destination.add('>');
+    } else {
+      destination.add("</Row>");
+    }
+  }
+  void open(const bool dictionary) {
+    beforeValue();
+    Level &level = stack.push();
+    level.dictionary = dictionary;
+    level.values = 0;
+  }
+
+  IDestination &destination;
+  const ITranslator &translator;
+  BinaryEncoding binary;
+  LevelStack<Level> stack;
+};
+
+class YAML_Handler final : public IParseHandler {
+public:
+  YAML_Handler(IDestination &destination, const ITranslator &translator,
+               const BinaryEncoding binary)
+      : destination(destination), translator(translator), binary(binary) {}
+
+  void onInteger(const std::int64_t value) override {
+    beforeValue();
+    destination.add(IntegerFormat{value}.view());
+    destination.add('\n');
+  }
+  void onString(const std::string_view value) override {
+    beforeValue();
+    if (encodeAsBinary(value, binary)) {
+      destination.add(binary == BinaryEncoding::Hex ? "!hex \""
+                                                    : "!!binary \"");
+      addBinary(value, binary, destination);
+      destination.add("\"\n");
+      return;
+    }
+    destination.add('"');
+    translator.to(value, destination);
+    destination.add("\"\n");
+  }
+  void onListBegin() override { open(false); }
+  void onListEnd() override { close("[]\n"); }
+  void onDictionaryBegin() override { open(true); }
+  void onDictionaryEnd() override { close("{}\n"); }
+  void onKey(const std::string_view key) override {
+    Level &level = stack.top();
+    level.empty = false;
+    YAML_Stringify::addIndent(destination, level.indent);
+    destination.add('"');
+    destination.add(key);
+    destination.add("\": ");
+  }
+
+private:
+  struct Level {
+    bool dictionary = false;
+    bool empty = true;
+    unsigned long indent = 0;
+  };
+  // List elements start a "- " line
+  void beforeValue() {
+    if (stack.empty() || stack.top().dictionary) {
+      return;
+    }
+    stack.top().empty = false;
+    YAML_Stringify::addIndent(destination, stack.top().indent);
+    destination.add("- ");
+  }
+  void open(const bool dictionary) {
+    beforeValue();
+    unsigned long indent = 0;
+    if (!stack.empty()) {
+      // Containers that are dictionary values start on the next line
+      if (stack.top().dictionary) {
+        destination.add('\n');
+      }
+      indent = stack.top().indent + 2;
+    }
+    Level &level = stack.push();
+    level.dictionary = dictionary;
+    level.empty = true;
+    level.indent = indent;
+  }
+  void close(const std::string_view empty) {
+    if (stack.top().empty) {
+      destination.add(empty);
+    }
+    stack.pop();
+  }
+
+  IDestination &destination;
+  const ITranslator &translator;
+  BinaryEncoding binary;
+  LevelStack<Level> stack;
+};
+
+} // namespace
+
+Transcoder::Transcoder(const TranscodeFormat format,
+                       const BinaryEncoding binary,
+                       std::unique_ptr<ITranslator> translator)
+    : format(format), binary(binary), translator(std::move(translator)) {
+  if (!this->translator) {
+    if (format == TranscodeFormat::XML) {
+      this->translator = std::make_unique<XML_Translator>();
+    } else {
+      this->translator = std::make_unique<Default_Translator>();
+    }
+  }
+}
+/// <summary>
+/// Convert the value at the source position, writing the format's document
+/// header and trailer around it.
+/// </summary>
+/// <param name="source">Reference to input interface used to parse Bencoded
+/// stream.</param> <param name="destination">Destination for the converted
+/// output.</param>
+/// <returns>Nothing (throws on error) or status of conversion.</returns>
+Transcoder::ParseResultType Transcoder::transcode(ISource &source,
+                                                  IDestination &destination) {
+  if (format == TranscodeFormat::XML) {
+    XML_Handler handler{destination, *translator, binary};
+    destination.add(R"(<?xml version="1.0" encoding="UTF-8"?>)");
+    destination.add("<root>");
+#if BENCODE_ENABLE_EXCEPTIONS
+    convert(source, handler);
+#else
+    if (ParseStatus status = convert(source, handler); !status.ok()) {
+      return status;
+    }
+#endif
+    destination.add("</root>");
+  } else if (format == TranscodeFormat::YAML) {
+    YAML_Handler handler{destination, *translator, binary};
+    destination.add("---\n");
+#if BENCODE_ENABLE_EXCEPTIONS
+    convert(source, handler);
+#else
+    if (ParseStatus status = convert(source, handler); !status.ok()) {
+      return status;
+    }
+#endif
+    destination.add("...\n");
+  } else {
+    JSON_Handler handler{destination, *translator, binary};
+    return convert(source, handler);
+  }
+#if !BENCODE_ENABLE_EXCEPTIONS
+  return ParseStatus::success();
+#endif
+}
+
+/// <summary>
+/// Parse one value into the handler, rejecting any input left after it as
+/// Bencode::parse does.
+/// </summary>
+/// <param name="source">Reference to input interface used to parse Bencoded
+/// stream.</param> <param name="handler">Handler writing the
+/// output.</param>
+/// <returns>Nothing (throws on error) or status of conversion.</returns>
+Transcoder::ParseResultType Transcoder::convert(ISource &source,
+                                                IParseHandler &handler) {
+#if BENCODE_ENABLE_EXCEPTIONS
+  parser.parse(source, handler);
+  if (source.more()) {
+    throw SyntaxError("Source stream terminated early.");
+  }
+#else
+  if (ParseStatus status = parser.parse(source, handler); !status.ok()) {
+    return status;
+  }
+  if (source.more()) {
+    return ParseStatus::failure(ErrorCode::SourceTerminatedEarly,
+                                "Source stream terminated early.");
+  }
+  return ParseStatus::success();
+#endif
+}
+
+Transcoder::ParseResultType Transcoder::transcode(ISource &&source,
+                                                  IDestination &destination) {
+  return transcode(source, destination);
+}
+
+} // namespace Bencode_Lib
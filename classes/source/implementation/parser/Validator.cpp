@@ -0,0 +1,366 @@
+// File: Validator.cpp
+//
+// Description: Source implementation of the allocation free Bencode validator.
+//
+
+#include "Validator.hpp"
+#include "Default_Parser_Internal.hpp"
+
+#include <algorithm>
+#include <array>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Bencode_Lib {
+
+namespace {
+
+// Bytes looked at per step when skipping payloads of sources whose views do
+// not stay valid (keeps block read sources from growing their buffers)
+constexpr std::size_t kSkipWindow = 4096;
+
+// Open container
+struct Frame {
+  // Last key (a view of the source or of lastKeyCopy)
+  std::string_view lastKey{};
+  std::string lastKeyCopy{};
+  bool dictionary = false;
+  bool hasKey = false;
+  bool awaitingValue = false;
+};
+
+class Validation {
+public:
+  Validation(ISource &source, const std::span<Frame> frames)
+      : source(source), frames(frames), inPlace(source.stable()) {}
+  [[nodiscard]] ParseStatus run();
+
+private:
+  [[nodiscard]] ParseStatus failure(ErrorCode code, std::string_view message,
+                                    std::size_t offset) const;
+  [[nodiscard]] ParseStatus endOfSource() const;
+  [[nodiscard]] ParseStatus integerFailure(IntegerScan scan, char first,
+                                           std::size_t offset) const;
+  [[nodiscard]] ParseStatus pushFrame(bool dictionary);
+  [[nodiscard]] ParseStatus checkInteger();
+  [[nodiscard]] ParseStatus scanLength(std::size_t &length);
+  [[nodiscard]] ParseStatus checkKey();
+  [[nodiscard]] ParseStatus skipPayload(std::size_t length);
+  [[nodiscard]] ParseStatus copyPayload(std::size_t length);
+
+  ISource &source;
+  std::span<Frame> frames;
+  std::size_t depth = 0;
+  bool inPlace;
+  // Key being read from a source whose views do not stay valid
+  std::string keyCopy;
+};
+
+ParseStatus Validation::failure(const ErrorCode code,
+                                const std::string_view message,
+                                const std::size_t offset) const {
+  return ParseStatus::failure(code, std::string(message), offset);
+}
+
+ParseStatus Validation::endOfSource() const {
+  return failure(ErrorCode::UnexpectedEndOfSource, "Unexpected end of source.",
+                 source.position());
+}
+/// <summary>
+/// Failure for an integer (or string length) that did not scan; an empty
+/// integer and one with a leading zero share a scan result so the first
+/// digit tells them apart.
+/// </summary>
+/// <param name="scan">Scan result.</param>
+/// <param name="first">First character of the integer.</param>
+/// <param name="offset">Source offset of the integer.</param>
+/// <returns>Failure status.</returns>
+ParseStatus Validation::integerFailure(const IntegerScan scan,
+                                       const char first,
+                                       const std::size_t offset) const {
+  ErrorCode code = ErrorCode::IntegerOverflow;
+  if (scan == IntegerScan::EmptyOrLeadingZero) {
+    code = first == '0' ? ErrorCode::LeadingZero : ErrorCode::InvalidInteger;
+  } else if (scan == IntegerScan::NegativeZero) {
+    code = ErrorCode::NegativeZero;
+  }
+  return failure(code, integerScanStatus(scan).message, offset);
+}
+
+ParseStatus Validation::pushFrame(const bool dictionary) {
+  if (depth + 1 >= Default_Parser::getMaxParserDepth()) {
+    return failure(ErrorCode::MaximumParserDepthExceeded,
+                   "Maximum parser depth exceeded.", source.position());
+  }
+  Frame &frame = frames[depth++];
+  frame.dictionary = dictionary;
+  frame.hasKey = false;
+  frame.awaitingValue = false;
+  frame.lastKey = {};
+  source.next();
+  return ParseStatus::success();
+}
+/// <summary>
+/// Check an integer (source on its 'i') and move past it.
+/// </summary>
+/// <returns>Status of check.</returns>
+ParseStatus Validation::checkInteger() {
+  const std::size_t start = source.position();
+  source.next();
+  if (!source.more()) {
+    return endOfSource();
+  }
+  const char first = source.current();
+  Bencode::IntegerType value = 0;
+  if (const IntegerScan scan = scanInteger(source, value);
+      scan != IntegerScan::Ok) {
+    return integerFailure(scan, first, start);
+  }
+  if (!source.more()) {
+    return endOfSource();
+  }
+  if (source.current() != ParserConstants::END) {
+    return failure(ErrorCode::MissingEndTerminator,
+                   "Missing end terminator on e", source.position());
+  }
+  source.next();
+  return ParseStatus::success();
+}
+/// <summary>
+/// Scan a string length prefix and its ':' separator leaving the source on
+/// the payload.
+/// </summary>
+/// <param name="length">Payload length.</param>
+/// <returns>Status of scan.</returns>
+ParseStatus Validation::scanLength(std::size_t &length) {
+  const std::size_t start = source.position();
+  const char first = source.current();
+  Bencode::IntegerType value = 0;
+  if (const IntegerScan scan = scanInteger(source, value);
+      scan != IntegerScan::Ok) {
+    return integerFailure(scan, first, start);
+  }
+  if (value < 0) {
+    return failure(ErrorCode::NegativeStringLength, "Negative string length.",
+                   start);
+  }
+  if (!source.more()) {
+    return endOfSource();
+  }
+  if (source.current() != ParserConstants::COLON) {
+    return failure(ErrorCode::MissingColon,
+                   "Missing colon separator in string value.",
+                   source.position());
+  }
+  if (static_cast<uint64_t>(value) > String::getMaxStringLength()) {
+    return failure(ErrorCode::StringTooLong,
+                   "String size exceeds maximum allowed size.", start);
+  }
+  source.next();
+  length = static_cast<std::size_t>(value);
+  return ParseStatus::success();
+}
+/// <summary>
+/// Move past a string payload checking that all of it is present.
+/// </summary>
+/// <param name="length">Payload length.</param>
+/// <returns>Status of skip.</returns>
+ParseStatus Validation::skipPayload(std::size_t length) {
+  while (length > 0) {
+    const std::string_view window =
+        source.peek(inPlace ? length : std::min(length, kSkipWindow));
+    if (window.empty()) {
+      // No contiguous storage (or none left)
+      if (!source.more()) {
+        return endOfSource();
+      }
+      source.next();
+      --length;
+      continue;
+    }
+    source.skip(window.size());
+    length -= window.size();
+  }
+  return ParseStatus::success();
+}
+/// <summary>
+/// Copy a key payload from a source whose views do not stay valid into the
+/// reused key buffer.
+/// </summary>
+/// <param name="length">Payload length.</param>
+/// <returns>Status of copy.</returns>
+ParseStatus Validation::copyPayload(std::size_t length) {
+  keyCopy.clear();
+  while (length > 0) {
+    const std::string_view window =
+        source.peek(std::min(length, kSkipWindow));
+    if (window.empty()) {
+      if (!source.more()) {
+        return endOfSource();
+      }
+      keyCopy += source.current();
+      source.next();
+      --length;
+      continue;
+    }
+    keyCopy.append(window);
+    source.skip(window.size());
+    length -= window.size();
+  }
+  return ParseStatus::success();
+}
+/// <summary>
+/// Read the next dictionary key and check it follows the previous one.
+/// </summary>
+/// <returns>Status of check.</returns>
+ParseStatus Validation::checkKey() {
+  const std::size_t start = source.position();
+  if (std::isdigit(static_cast<unsigned char>(source.current())) == 0) {
+    return failure(ErrorCode::UnexpectedToken,
+                   "Dictionary key is not a string.", start);
+  }
+  std::size_t length = 0;
+  if (ParseStatus status = scanLength(length); !status.ok()) {
+    return status;
+  }
+  std::string_view key;
+  if (inPlace) {
+    key = source.peek(length);
+    if (key.size() != length) {
+      source.skip(key.size());
+      return endOfSource();
+    }
+    source.skip(length);
+  } else {
+    if (ParseStatus status = copyPayload(length); !status.ok()) {
+      return status;
+    }
+    key = keyCopy;
+  }
+  Frame &frame = frames[depth - 1];
+  if (frame.hasKey) {
+    if (frame.lastKey > key) {
+      return failure(ErrorCode::DictionaryKeyOrder,
+                     "Dictionary keys not in sequence.", start);
+    }
+    if (frame.lastKey == key) {
+      return failure(ErrorCode::DuplicateDictionaryKey,
+                     "Duplicate dictionary key.", start);
+    }
+  }
+  if (inPlace) {
+    frame.lastKey = key;
+  } else {
+    std::swap(frame.lastKeyCopy, keyCopy);
+    frame.lastKey = frame.lastKeyCopy;
+  }
+  frame.hasKey = true;
+  frame.awaitingValue = true;
+  return ParseStatus::success();
+}
+/// <summary>
+/// Iteratively walk the value at the source position and check nothing
+/// follows it.
+/// </summary>
+/// <returns>Status of validation.</returns>
+ParseStatus Validation::run() {
+  if (!source.more()) {
+    return endOfSource();
+  }
+  if (Default_Parser::getMaxParserDepth() <= 1) {
+    return failure(ErrorCode::MaximumParserDepthExceeded,
+                   "Maximum parser depth exceeded.", source.position());
+  }
+  do {
+    if (depth > 0) {
+      if (!source.more()) {
+        return endOfSource();
+      }
+      Frame &frame = frames[depth - 1];
+      if (!frame.awaitingValue && source.current() == ParserConstants::END) {
+        source.next();
+        if (--depth > 0) {
+          frames[depth - 1].awaitingValue = false;
+        }
+        continue;
+      }
+      if (frame.dictionary && !frame.awaitingValue) {
+        if (ParseStatus status = checkKey(); !status.ok()) {
+          return status;
+        }
+        continue;
+      }
+    }
+    switch (source.current()) {
+    case ParserConstants::DICTIONARY:
+    case ParserConstants::LIST:
+      if (ParseStatus status =
+              pushFrame(source.current() == ParserConstants::DICTIONARY);
+          !status.ok()) {
+        return status;
+      }
+      continue;
+    case ParserConstants::INTEGER:
+      if (ParseStatus status = checkInteger(); !status.ok()) {
+        return status;
+      }
+      break;
+    case ParserConstants::STRING_0:
+    case ParserConstants::STRING_1:
+    case ParserConstants::STRING_2:
+    case ParserConstants::STRING_3:
+    case ParserConstants::STRING_4:
+    case ParserConstants::STRING_5:
+    case ParserConstants::STRING_6:
+    case ParserConstants::STRING_7:
+    case ParserConstants::STRING_8:
+    case ParserConstants::STRING_9:
+    case ParserConstants::STRING_MINUS:
+    case ParserConstants::STRING_PLUS: {
+      std::size_t length = 0;
+      if (ParseStatus status = scanLength(length); !status.ok()) {
+        return status;
+      }
+      if (ParseStatus status = skipPayload(length); !status.ok()) {
+        return status;
+      }
+      break;
+    }
+    default:
+      return failure(
+          ErrorCode::UnexpectedToken,
+          depth == 0
+              ? "Expected integer, string, list or dictionary not present."
+              : "Expected integer or string while parsing container.",
+          source.position());
+    }
+    if (depth > 0) {
+      frames[depth - 1].awaitingValue = false;
+    }
+  } while (depth > 0);
+  if (source.more()) {
+    return failure(ErrorCode::SourceTerminatedEarly,
+                   "Source stream terminated early.", source.position());
+  }
+  return ParseStatus::success();
+}
+
+} // namespace
+
+ParseStatus Validator::validate(ISource &source) {
+  const std::size_t maxFrames = Default_Parser::getMaxParserDepth();
+  std::array<Frame, kInlineFrames> inlineFrames;
+  std::vector<Frame> heapFrames;
+  std::span<Frame> frames{inlineFrames};
+  if (maxFrames > kInlineFrames) {
+    heapFrames.resize(maxFrames);
+    frames = heapFrames;
+  }
+  return Validation{source, frames}.run();
+}
+
+ParseStatus Validator::validate(ISource &&source) { return validate(source); }
+
+} // namespace Bencode_Lib
@@ -0,0 +1,387 @@
+// File: Bencode_Tape.cpp
+//
+// Description: Source implementation of the flat tape Bencode document, its cursors and encoder.
+//
+
+#include "Bencode_Tape.hpp"
+#include "Default_Parser_Internal.hpp"
+
+#include <charconv>
+#include <limits>
+
+namespace Bencode_Lib {
+
+namespace {
+
+// Container open while building a tape from a structural index
+struct TapeFrame {
+  std::size_t start;
+  std::size_t count = 0;
+  bool dictionary;
+  std::string_view lastKey{};
+  bool awaitingValue = false;
+};
+
+} // namespace
+
+Variant::Type BencodeTape::Cursor::getNodeType() const {
+  switch (tape->tag(index)) {
+  case 'i':
+    return Variant::Type::integer;
+  case 's':
+    return Variant::Type::string;
+  case 'l':
+    return Variant::Type::list;
+  case 'd':
+    return Variant::Type::dictionary;
+  default:
+    return Variant::Type::base;
+  }
+}
+
+void BencodeTape::Cursor::checkTag(const char tag,
+                                   const char *message) const {
+  if (tape->tag(index) != tag) {
+    throw Error(message);
+  }
+}
+
+Bencode::IntegerType BencodeTape::Cursor::integer() const {
+  checkTag('i', "Tape value not an integer.");
+  return static_cast<Bencode::IntegerType>(tape->tape[index + 1]);
+}
+
+std::string_view BencodeTape::Cursor::string() const {
+  checkTag('s', "Tape value not a string.");
+  return tape->stringAt(index);
+}
+
+std::size_t BencodeTape::Cursor::size() const {
+  if (tape->tag(index) != 'l' && tape->tag(index) != 'd') {
+    throw Error("Tape value not a list or dictionary.");
+  }
+  return static_cast<std::size_t>(tape->tape[index + 1]);
+}
+
+BencodeTape::Cursor
+BencodeTape::Cursor::operator[](const std::size_t position) const {
+  checkTag('l', "Tape value not a list.");
+  if (position >= size()) {
+    throw Error("Invalid index used in list.");
+  }
+  std::size_t element = index + 2;
+  for (std::size_t skipped = 0; skipped < position; ++skipped) {
+    element = tape->nextIndex(element);
+  }
+  return Cursor(*tape, element);
+}
+
+bool BencodeTape::Cursor::findKey(const std::string_view &key,
+                                  std::size_t &valueIndex) const {
+  checkTag('d', "Tape value not a dictionary.");
+  const std::size_t end = tape->payload(index) - 1;
+  for (std::size_t entry = index + 2; entry < end;
+       entry = tape->nextIndex(entry + 2)) {
+    const std::string_view entryKey = tape->stringAt(entry);
+    if (entryKey == key) {
+      valueIndex = entry + 2;
+      return true;
+    }
+    // Keys are stored in sorted order
+    if (entryKey > key) {
+      break;
+    }
+  }
+  return false;
+}
+
+BencodeTape::Cursor
+BencodeTape::Cursor::operator[](const std::string_view &key) const {
+  std::size_t valueIndex = 0;
+  if (!findKey(key, valueIndex)) {
+    throw Error("Invalid key used in dictionary.");
+  }
+  return Cursor(*tape, valueIndex);
+}
+
+bool BencodeTape::Cursor::contains(const std::string_view &key) const {
+  std::size_t valueIndex = 0;
+  return findKey(key, valueIndex);
+}
+
+BencodeTape::Iterator BencodeTape::Cursor::begin() const {
+  [[maybe_unused]] const std::size_t count = size();
+  return Iterator(*tape, index + 2, tape->tag(index) == 'd');
+}
+
+BencodeTape::Iterator BencodeTape::Cursor::end() const {
+  [[maybe_unused]] const std::size_t count = size();
+  return Iterator(*tape, tape->payload(index) - 1, tape->tag(index) == 'd');
+}
+
+std::string_view BencodeTape::Iterator::key() const {
+  if (!dictionary) {
+    throw Error("Tape value not a dictionary.");
+  }
+  return tape->stringAt(index);
+}
+
+void BencodeTape::append(const char valueTag, const std::uint64_t valuePayload,
+                         const std::uint64_t data) {
+  tape.push_back((static_cast<std::uint64_t>(valueTag) << kTagShift) |
+                 valuePayload);
+  tape.push_back(data);
+}
+
+void BencodeTape::appendString(const std::string_view &string) {
+  append('s', arena.size(), string.size());
+  arena.append(string);
+}
+
+std::size_t BencodeTape::beginContainer(const char valueTag) {
+  const std::size_t start = tape.size();
+  append(valueTag, 0, 0);
+  return start;
+}
+
+void BencodeTape::endContainer(const std::size_t start,
+                               const std::size_t count) {
+  tape.push_back((static_cast<std::uint64_t>('e') << kTagShift) | start);
+  tape[start] |= tape.size();
+  tape[start + 1] = count;
+}
+/// <summary>
+/// Build the tape directly from the structural index of a contiguous source.
+/// </summary>
+/// <param name="source">Reference to input interface used to parse Bencoded
+/// stream.</param>
+/// <returns>false (source untouched) if the input needs the default parser.
+/// </returns>
+bool BencodeTape::parseIndexed(ISource &source) {
+  // Buffered sources would have to read the rest of their input into memory
+  if (!source.contiguous()) {
+    return false;
+  }
+  const std::string_view document =
+      source.peek(std::numeric_limits<std::size_t>::max());
+  if (document.empty()) {
+    return false;
+  }
+  std::vector<Indexed_Parser::Token> tokens;
+  const std::size_t consumed = Indexed_Parser::buildIndex(document, tokens);
+  if (consumed == 0) {
+    return false;
+  }
+  tape.reserve(tokens.size() * 2);
+  arena.reserve(document.size());
+  std::vector<TapeFrame> frameStack;
+  frameStack.reserve(16);
+  for (const Indexed_Parser::Token &token : tokens) {
+    if (!frameStack.empty() && frameStack.back().dictionary &&
+        !frameStack.back().awaitingValue) {
+      TapeFrame &frame = frameStack.back();
+      if (token.kind == Indexed_Parser::Token::Kind::String) {
+        const std::string_view key = document.substr(token.offset, token.length);
+        if (frame.count > 0 && frame.lastKey >= key) {
+          return false;
+        }
+        appendString(key);
+        frame.lastKey = key;
+        frame.count++;
+        frame.awaitingValue = true;
+        continue;
+      }
+      if (token.kind != Indexed_Parser::Token::Kind::End) {
+        return false;
+      }
+    }
+    // A dictionary may not end between a key and its value
+    if (token.kind == Indexed_Parser::Token::Kind::End &&
+        !frameStack.empty() && frameStack.back().dictionary &&
+        frameStack.back().awaitingValue) {
+      return false;
+    }
+    switch (token.kind) {
+    case Indexed_Parser::Token::Kind::Dictionary:
+      frameStack.push_back({beginContainer('d'), 0, true});
+      continue;
+    case Indexed_Parser::Token::Kind::List:
+      frameStack.push_back({beginContainer('l'), 0, false});
+      continue;
+    case Indexed_Parser::Token::Kind::End:
+      endContainer(frameStack.back().start, frameStack.back().count);
+      frameStack.pop_back();
+      break;
+    case Indexed_Parser::Token::Kind::Integer: {
+      Bencode::IntegerType integer = 0;
+      if (token.length > IntegerDigitBuffer{}.size() ||
+          convertIntegerDigits(document.data() + token.offset, token.length,
+                               integer) != IntegerScan::Ok) {
+        return false;
+      }
+      append('i', 0, static_cast<std::uint64_t>(integer));
+      break;
+    }
+    case Indexed_Parser::Token::Kind::String:
+    default:
+      appendString(document.substr(token.offset, token.length));
+      break;
+    }
+    if (!frameStack.empty()) {
+      TapeFrame &parent = frameStack.back();
+      if (parent.dictionary) {
+        parent.awaitingValue = false;
+      } else {
+        parent.count++;
+      }
+    }
+  }
+  source.skip(consumed);
+  return true;
+}
+
+void BencodeTape::appendNode(const Node &bNode) {
+  if (isA<Integer>(bNode)) {
+    append('i', 0, static_cast<std::uint64_t>(NRef<Integer>(bNode).value()));
+  } else if (isA<String>(bNode)) {
+    appendString(NRef<String>(bNode).value());
+  } else if (isA<List>(bNode)) {
+    const std::size_t start = beginContainer('l');
+    std::size_t count = 0;
+    for (const auto &element : NRef<List>(bNode).value()) {
+      if (!isA<Hole>(element)) {
+        appendNode(element);
+        count++;
+      }
+    }
+    endContainer(start, count);
+  } else if (isA<Dictionary>(bNode)) {
+    const std::size_t start = beginContainer('d');
+    std::size_t count = 0;
+    for (const auto &entry : NRef<Dictionary>(bNode).value()) {
+      if (!isA<Hole>(entry.getNode())) {
+        appendString(entry.getKey());
+        appendNode(entry.getNode());
+        count++;
+      }
+    }
+    endContainer(start, count);
+  }
+}
+
+BencodeTape BencodeTape::fromNode(const Node &bNode) {
+  BencodeTape flattened;
+  if (!bNode.isEmpty() && !isA<Hole>(bNode)) {
+    flattened.appendNode(bNode);
+  }
+  return flattened;
+}
+
+#if BENCODE_ENABLE_EXCEPTIONS
+
+BencodeTape::ParseResultType BencodeTape::parse(ISource &source) {
+  tape.clear();
+  arena.clear();
+  if (!parseIndexed(source)) {
+    tape.clear();
+    arena.clear();
+    // Default parser reports errors and handles non-contiguous sources
+    Default_Parser parser;
+    *this = fromNode(parser.parse(source));
+  }
+  // Trailing data is rejected as it is by Bencode::parse
+  if (source.more()) {
+    tape.clear();
+    arena.clear();
+    throw SyntaxError("Source stream terminated early.");
+  }
+}
+
+#else
+
+BencodeTape::ParseResultType BencodeTape::parse(ISource &source) {
+  tape.clear();
+  arena.clear();
+  if (!parseIndexed(source)) {
+    tape.clear();
+    arena.clear();
+    // Default parser reports errors and handles non-contiguous sources
+    Default_Parser parser;
+    Node root;
+    if (ParseStatus status = parser.parse(source, root); !status.ok()) {
+      return status;
+    }
+    *this = fromNode(root);
+  }
+  // Trailing data is rejected as it is by Bencode::parse
+  if (source.more()) {
+    tape.clear();
+    arena.clear();
+    return ParseStatus::failure(ErrorCode::SourceTerminatedEarly,
+                                "Source stream terminated early.");
+  }
+  return ParseStatus::success();
+}
+
+#endif
+
+BencodeTape::ParseResultType BencodeTape::parse(ISource &&source) {
+  return parse(source);
+}
+
+BencodeTape::Cursor BencodeTape::root() const {
+  if (tape.empty()) {
+    throw Error("No Bencode on tape.");
+  }
+  return Cursor(*this, 0);
+}
+/// <summary>
+/// Encode the tape into Bencode on the destination passed in. The tape is
+/// already in document order so this is a single linear pass.
+/// </summary>
+/// <param name="destination">Destination stream for stringified
+/// Bencode.</param>
+void BencodeTape::stringify(IDestination &destination) const {
+  char number[std::numeric_limits<std::uint64_t>::digits10 + 3];
+  std::size_t index = 0;
+  while (index < tape.size()) {
+    switch (tag(index)) {
+    case 'i': {
+      const auto result =
+          std::to_chars(number, number + sizeof(number),
+                        static_cast<Bencode::IntegerType>(tape[index + 1]));
+      destination.add('i');
+      destination.add(std::string_view(number, result.ptr - number));
+      destination.add('e');
+      index += 2;
+      break;
+    }
+    case 's': {
+      const std::string_view string = stringAt(index);
+      const auto result =
+          std::to_chars(number, number + sizeof(number), string.size());
+      destination.add(std::string_view(number, result.ptr - number));
+      destination.add(':');
+      destination.add(string);
+      index += 2;
+      break;
+    }
+    case 'l':
+    case 'd':
+      destination.add(tag(index));
+      index += 2;
+      break;
+    case 'e':
+    default:
+      destination.add('e');
+      index++;
+      break;
+    }
+  }
+}
+
+void BencodeTape::stringify(IDestination &&destination) const {
+  stringify(destination);
+}
+
+} // namespace Bencode_Lib
@@ -174,5 +174,5 @@ inline std::string TorrentInfo::dump() {
 /// <param name="fileName">Torrent file name</param>
 inline void TorrentInfo::load(const std::string &fileName) {
   torrentFileName = fileName;
-  bStringify.parse(Bencode_Lib::FileSource{torrentFileName});
+  bStringify.parse(Bencode_Lib::MmapFileSource{torrentFileName});
 }
\ No newline at end of file
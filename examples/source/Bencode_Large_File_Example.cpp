@@ -7,9 +7,9 @@
 namespace be = Bencode_Lib;
 
 int main() {
-  // Read Bencode data from a file
-  std::string fileData = be::Bencode::fromFile("large_example.torrent");
-  be::Bencode doc(fileData);
+  // Parse Bencode data straight from the memory mapped file
+  be::Bencode doc;
+  doc.parse(be::MmapFileSource{"large_example.torrent"});
   // Print root node type (as integer value)
   // 0: integer, 1: string, 2: list, 3: dictionary (see Variant::Type enum in
   // docs)
@@ -24,14 +24,20 @@ std::string modifiedPath(const std::string &original) {
 /// Parse torrent, inject/overwrite its "comment" field, and save.
 /// </summary>
 void injectComment(const std::string &fileName, const std::string &comment) {
-  be::Bencode torrent;
-  torrent.parse(be::FileSource{fileName});
+  // Record container source ranges so that the untouched "info" dictionary
+  // is copied from the mapped file rather than re-encoded
+  be::MmapFileSource source{fileName};
+  be::Bencode torrent{nullptr, be::makeParser<be::Default_Parser>(
+                                   be::ParseOptions{.sourceRanges = true})};
+  torrent.parse(source);
 
   // Modify or add the top-level "comment" key
   torrent["comment"] = comment;
 
   const std::string outFile = modifiedPath(fileName);
-  torrent.stringify(be::FileDestination{outFile});
+  be::FileDestination destination{outFile};
+  be::Default_Stringify{source.contents()}.stringify(torrent.root(),
+                                                      destination);
   PLOG_INFO << "Written modified torrent to " << outFile;
 }
 
@@ -14,7 +14,8 @@ namespace be = Bencode_Lib;
 
 int main([[maybe_unused]] int argc, [[maybe_unused]] char **argv) {
   try {
-    const be::Bencode bStringify(be::makeStringify<be::JSON_Stringify>());
+    const be::Bencode bStringify(
+        be::makeStringify<be::JSON_Stringify>(be::BinaryEncoding::Base64));
     // Initialise logging.
     init(plog::debug, "Bencode_Files_To_JSON.log");
     PLOG_INFO << "Bencode_Files_To_JSON started ...";
@@ -1,28 +1,28 @@
 //
 // Program:  Bencode_Files_To_YAML
 //
-// Description: Use Bencode_Lib to read in torrent file then write
-// it out as YAML using a custom stringify.
+// Description: Use Bencode_Lib to convert torrent files to YAML as they
+// are read, without building a Bencode tree.
 //
 // Dependencies: C++20, PLOG,  Bencode_Lib.
 //
 
 #include "Bencode_Utility.hpp"
-#include "YAML_Stringify.hpp"
+#include "Transcoder.hpp"
 
 namespace be = Bencode_Lib;
 
 int main([[maybe_unused]] int argc, [[maybe_unused]] char **argv) {
     try {
-        const be::Bencode bStringify(be::makeStringify<be::YAML_Stringify>());
+        be::Transcoder transcoder(be::TranscodeFormat::YAML);
         // Initialise logging.
         init(plog::debug, "Bencode_Files_To_YAML.log");
         PLOG_INFO << "Bencode_Files_To_YAML started ...";
         PLOG_INFO << be::Bencode::version();
         for (const auto &fileName : Utility::createTorrentFileList()) {
-            bStringify.parse(be::FileSource(fileName));
-            bStringify.stringify(be::FileDestination(
-                Utility::createFileName(fileName, ".yaml")));
+            be::FileDestination destination(
+                Utility::createFileName(fileName, ".yaml"));
+            transcoder.transcode(be::FileSource(fileName), destination);
             PLOG_INFO << "Created file "
                       << Utility::createFileName(fileName, ".yaml") << " from "
                       << fileName;
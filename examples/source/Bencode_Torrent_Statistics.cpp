@@ -36,51 +36,85 @@ std::string fileExtension(const std::string &path) {
 }
 
 /// <summary>
-/// Accumulate statistics from a single torrent's parsed Bencode tree.
+/// Accumulate statistics from a single torrent's parse events; only the
+/// fields needed are kept so no Bencode tree is built.
 /// </summary>
-void accumulateStats(const be::Bencode &torrent, TorrentStats &stats) {
-  auto &root = be::NRef<be::Dictionary>(torrent.root());
-
-  // Collect tracker URL
-  if (root.contains("announce")) {
-    stats.trackers.insert(
-        std::string(be::NRef<be::String>(root["announce"]).value()));
+class TorrentStatsHandler final : public be::IParseHandler {
+public:
+  explicit TorrentStatsHandler(TorrentStats &stats) : stats(stats) {}
+  void onDictionaryBegin() override { keys.emplace_back(); }
+  void onListBegin() override { keys.emplace_back(); }
+  void onKey(const std::string_view key) override { keys.back() = key; }
+  void onDictionaryEnd() override {
+    if (inside({"info", "files", ""})) {
+      // Multi-file torrent entry
+      addFile(fileLength, filePath.string());
+      fileLength = 0;
+      filePath.clear();
+    } else if (inside({"info"}) && singleFile) {
+      // Single-file torrent
+      addFile(singleLength, name);
+    }
+    keys.pop_back();
   }
-
-  if (!root.contains("info")) {
-    return;
+  void onListEnd() override { keys.pop_back(); }
+  void onInteger(const std::int64_t value) override {
+    if (at({"info", "length"})) {
+      singleLength = value;
+      singleFile = true;
+    } else if (at({"info", "files", "", "length"})) {
+      fileLength = value;
+    }
   }
-
-  auto &info = be::NRef<be::Dictionary>(root["info"]);
-
-  // Multi-file torrent
-  if (info.contains("files")) {
-    for (auto &fileNode : be::NRef<be::List>(info["files"]).value()) {
-      auto &fileDict = be::NRef<be::Dictionary>(fileNode);
-      const auto length = be::NRef<be::Integer>(fileDict["length"]).value();
-      stats.totalBytes += static_cast<std::uint64_t>(length);
-      stats.totalFiles++;
-
-      // Build path from "path" list
-      if (fileDict.contains("path")) {
-        std::filesystem::path filePath;
-        for (auto &part : be::NRef<be::List>(fileDict["path"]).value()) {
-          filePath /= be::NRef<be::String>(part).value();
-        }
-        stats.extensionCounts[fileExtension(filePath.string())]++;
-      }
+  void onString(const std::string_view value) override {
+    if (at({"announce"})) {
+      stats.trackers.insert(std::string(value));
+    } else if (at({"info", "name"})) {
+      name = value;
+    } else if (at({"info", "files", "", "path", ""})) {
+      filePath /= value;
     }
-  } else if (info.contains("length")) {
-    // Single-file torrent
-    const auto length = be::NRef<be::Integer>(info["length"]).value();
+  }
+
+private:
+  // Is the current value at the key path (list elements have key "") ?
+  [[nodiscard]] bool
+  at(const std::initializer_list<std::string_view> path) const {
+    return std::equal(keys.begin(), keys.end(), path.begin(), path.end());
+  }
+  // Is the container being closed the one at the key path ?
+  [[nodiscard]] bool
+  inside(const std::initializer_list<std::string_view> path) const {
+    return keys.size() == path.size() + 1 &&
+           std::equal(path.begin(), path.end(), keys.begin());
+  }
+  void addFile(const std::int64_t length, const std::string &path) {
     stats.totalBytes += static_cast<std::uint64_t>(length);
     stats.totalFiles++;
-
-    if (info.contains("name")) {
-      const std::string name{be::NRef<be::String>(info["name"]).value()};
-      stats.extensionCounts[fileExtension(name)]++;
+    if (!path.empty()) {
+      stats.extensionCounts[fileExtension(path)]++;
     }
   }
+
+  TorrentStats &stats;
+  std::vector<std::string> keys;
+  std::int64_t singleLength{};
+  bool singleFile{};
+  std::string name;
+  std::int64_t fileLength{};
+  std::filesystem::path filePath;
+};
+
+/// <summary>
+/// Add the statistics of one torrent to the running totals.
+/// </summary>
+void mergeStats(const TorrentStats &torrent, TorrentStats &stats) {
+  stats.totalFiles += torrent.totalFiles;
+  stats.totalBytes += torrent.totalBytes;
+  stats.trackers.insert(torrent.trackers.begin(), torrent.trackers.end());
+  for (const auto &[ext, count] : torrent.extensionCounts) {
+    stats.extensionCounts[ext] += count;
+  }
 }
 
 /// <summary>
@@ -113,9 +147,12 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char **argv) {
 
     for (const auto &fileName : fileList) {
       try {
-        be::Bencode torrent;
-        torrent.parse(be::FileSource{fileName});
-        accumulateStats(torrent, stats);
+        // Events arrive while parsing so only merge torrents that parse
+        TorrentStats torrentStats;
+        TorrentStatsHandler handler{torrentStats};
+        be::Event_Parser parser;
+        parser.parse(be::FileSource{fileName}, handler);
+        mergeStats(torrentStats, stats);
         PLOG_INFO << "Processed " << fileName;
       } catch (std::exception &ex) {
         PLOG_ERROR << "Failed to process " << fileName << ": " << ex.what();
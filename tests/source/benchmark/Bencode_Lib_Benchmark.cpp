@@ -5,6 +5,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <string>
 
 using namespace Bencode_Lib;
@@ -32,14 +33,51 @@ static std::string makeLargeBencode(size_t count, size_t valueSize) {
   return encoded;
 }
 
+// Integer heavy corpus shaped like torrent file length lists and DHT node
+// tables: every entry holds a list of integers of mixed magnitude
+static std::string makeIntegerBencode(size_t count) {
+  std::string encoded = "d";
+  encoded.reserve(count * 96);
+  const auto width = std::to_string(count - 1).size();
+  unsigned long long seed = 88172645463325252ull;
+  for (size_t index = 0; index < count; ++index) {
+    std::string indexString = std::to_string(index);
+    if (indexString.size() < width) {
+      indexString = std::string(width - indexString.size(), '0') + indexString;
+    }
+    const std::string key = "k" + indexString;
+    encoded += std::to_string(key.size());
+    encoded += ':';
+    encoded += key;
+    encoded += 'l';
+    for (int value = 0; value < 8; ++value) {
+      seed ^= seed << 13;
+      seed ^= seed >> 7;
+      seed ^= seed << 17;
+      // Magnitudes from single digits (ports, flags) to full 64 bit values
+      const auto integer =
+          static_cast<long long>(seed >> ((value * 8) + 1)) * (value % 3 ? 1 : -1);
+      encoded += 'i';
+      encoded += std::to_string(integer);
+      encoded += 'e';
+    }
+    encoded += 'e';
+  }
+  encoded += 'e';
+  return encoded;
+}
+
 static void printUsage(const char *programName) {
   std::cout
       << "Usage: " << programName
-      << " [count] [value-size] [iterations] [mode]\n"
+      << " [count] [value-size] [iterations] [mode] [parser] [corpus]\n"
       << "  count: number of dictionary entries (default 5000)\n"
       << "  value-size: bytes per value string (default 128)\n"
       << "  iterations: number of parse/stringify iterations (default 5)\n"
-      << "  mode: roundtrip|parse|stringify (default roundtrip)\n";
+      << "  mode: roundtrip|parse|stringify|json|xml|yaml (default "
+         "roundtrip)\n"
+      << "  parser: default|indexed (default default)\n"
+      << "  corpus: strings|integers (default strings)\n";
 }
 
 static bool parseArg(const char *arg, size_t &output) {
@@ -52,7 +90,14 @@ static bool parseArg(const char *arg, size_t &output) {
   }
 }
 
-enum class BenchmarkMode { Roundtrip, ParseOnly, StringifyOnly };
+enum class BenchmarkMode {
+  Roundtrip,
+  ParseOnly,
+  StringifyOnly,
+  ConvertJSON,
+  ConvertXML,
+  ConvertYAML
+};
 
 static bool parseModeArg(const char *arg, BenchmarkMode &mode) {
   const std::string value(arg);
@@ -68,6 +113,24 @@ static bool parseModeArg(const char *arg, BenchmarkMode &mode) {
     mode = BenchmarkMode::StringifyOnly;
     return true;
   }
+#if BENCODE_ENABLE_JSON_STRINGIFY
+  if (value == "json") {
+    mode = BenchmarkMode::ConvertJSON;
+    return true;
+  }
+#endif
+#if BENCODE_ENABLE_XML_STRINGIFY
+  if (value == "xml") {
+    mode = BenchmarkMode::ConvertXML;
+    return true;
+  }
+#endif
+#if BENCODE_ENABLE_YAML_STRINGIFY
+  if (value == "yaml") {
+    mode = BenchmarkMode::ConvertYAML;
+    return true;
+  }
+#endif
   return false;
 }
 
@@ -77,12 +140,36 @@ static std::string modeName(BenchmarkMode mode) {
     return "parse-only";
   case BenchmarkMode::StringifyOnly:
     return "stringify-only";
+  case BenchmarkMode::ConvertJSON:
+    return "convert-json";
+  case BenchmarkMode::ConvertXML:
+    return "convert-xml";
+  case BenchmarkMode::ConvertYAML:
+    return "convert-yaml";
   case BenchmarkMode::Roundtrip:
   default:
     return "roundtrip";
   }
 }
 
+static bool parseParserArg(const char *arg, bool &indexed) {
+  const std::string value(arg);
+  if (value == "default" || value == "indexed") {
+    indexed = value == "indexed";
+    return true;
+  }
+  return false;
+}
+
+static bool parseCorpusArg(const char *arg, bool &integers) {
+  const std::string value(arg);
+  if (value == "strings" || value == "integers") {
+    integers = value == "integers";
+    return true;
+  }
+  return false;
+}
+
 static constexpr double kBaselineParseMBs = 6.31829;
 static constexpr double kBaselineStringifyMBs = 13.241;
 
@@ -122,11 +209,32 @@ int main(int argc, char *argv[]) {
       return 1;
     }
   }
+  bool indexedParser = false;
+  if (argc > 5) {
+    if (!parseParserArg(argv[5], indexedParser)) {
+      printUsage(argv[0]);
+      return 1;
+    }
+  }
+  bool integerCorpus = false;
+  if (argc > 6) {
+    if (!parseCorpusArg(argv[6], integerCorpus)) {
+      printUsage(argv[0]);
+      return 1;
+    }
+  }
+  auto makeBenchmarkParser = [&]() -> IParser * {
+    return indexedParser ? makeParser<Indexed_Parser>() : nullptr;
+  };
 
-  const std::string encoded = makeLargeBencode(dictionarySize, valueSize);
+  const std::string encoded = integerCorpus
+                                  ? makeIntegerBencode(dictionarySize)
+                                  : makeLargeBencode(dictionarySize, valueSize);
   const double dataMB = static_cast<double>(encoded.size()) / (1024.0 * 1024.0);
 
   std::cout << "Benchmark mode: " << modeName(mode) << "\n";
+  std::cout << "Parser: " << (indexedParser ? "indexed" : "default") << "\n";
+  std::cout << "Corpus: " << (integerCorpus ? "integers" : "strings") << "\n";
 
   ObjectPool<List>::resetStats();
   ObjectPool<Dictionary>::resetStats();
@@ -141,7 +249,7 @@ int main(int argc, char *argv[]) {
       try {
         BufferSource source(encoded);
         const auto start = high_resolution_clock::now();
-        Bencode bencode;
+        Bencode bencode{nullptr, makeBenchmarkParser()};
         bencode.parse(source);
         const auto end = high_resolution_clock::now();
         const double iterationTime = duration<double>(end - start).count();
@@ -156,7 +264,7 @@ int main(int argc, char *argv[]) {
 #else
       BufferSource source(encoded);
       const auto start = high_resolution_clock::now();
-      Bencode bencode;
+      Bencode bencode{nullptr, makeBenchmarkParser()};
       ParseStatus status = bencode.parse(source);
       const auto end = high_resolution_clock::now();
       const double iterationTime = duration<double>(end - start).count();
@@ -178,7 +286,7 @@ int main(int argc, char *argv[]) {
     for (int i = 0; i < iterations; ++i) {
       try {
         BufferSource source(encoded);
-        Bencode bencode;
+        Bencode bencode{nullptr, makeBenchmarkParser()};
 #if BENCODE_ENABLE_EXCEPTIONS
         bencode.parse(source);
 #else
@@ -210,6 +318,52 @@ int main(int argc, char *argv[]) {
     return seconds;
   };
 
+  // Stringify the parsed tree with a JSON/XML/YAML stringifier; throughput is
+  // measured against the Bencode input size
+  auto runConvertBenchmark = [&](int iterations) {
+    std::unique_ptr<IStringify> stringifier;
+#if BENCODE_ENABLE_JSON_STRINGIFY
+    if (mode == BenchmarkMode::ConvertJSON) {
+      stringifier = std::make_unique<JSON_Stringify>();
+    }
+#endif
+#if BENCODE_ENABLE_XML_STRINGIFY
+    if (mode == BenchmarkMode::ConvertXML) {
+      stringifier = std::make_unique<XML_Stringify>();
+    }
+#endif
+#if BENCODE_ENABLE_YAML_STRINGIFY
+    if (mode == BenchmarkMode::ConvertYAML) {
+      stringifier = std::make_unique<YAML_Stringify>();
+    }
+#endif
+    Bencode bencode{nullptr, makeBenchmarkParser()};
+#if BENCODE_ENABLE_EXCEPTIONS
+    bencode.parse(BufferSource{encoded});
+#else
+    if (ParseStatus status = bencode.parse(BufferSource{encoded});
+        !status.ok()) {
+      std::cerr << "Convert parse failed: " << status.message << "\n";
+      std::exit(1);
+    }
+#endif
+    double seconds = 0.0;
+    std::size_t convertedSize = 0;
+    for (int i = 0; i < iterations; ++i) {
+      BufferDestination destination;
+      const auto start = high_resolution_clock::now();
+      stringifier->stringify(bencode.root(), destination);
+      const auto end = high_resolution_clock::now();
+      const double iterationTime = duration<double>(end - start).count();
+      seconds += iterationTime;
+      convertedSize = destination.size();
+      std::cout << "Convert iteration " << (i + 1) << ": " << iterationTime
+                << " s\n";
+    }
+    std::cout << "Converted size: " << convertedSize << " bytes\n";
+    return seconds;
+  };
+
   auto runRoundtripBenchmark = [&](int iterations) {
     double parseSeconds = 0.0;
     double stringifySeconds = 0.0;
@@ -218,7 +372,7 @@ int main(int argc, char *argv[]) {
       try {
         BufferSource source(encoded);
         const auto parseStart = high_resolution_clock::now();
-        Bencode bencode;
+        Bencode bencode{nullptr, makeBenchmarkParser()};
         bencode.parse(source);
         const auto parseEnd = high_resolution_clock::now();
         const double parseTime =
@@ -247,7 +401,7 @@ int main(int argc, char *argv[]) {
 #else
       BufferSource source(encoded);
       const auto parseStart = high_resolution_clock::now();
-      Bencode bencode;
+      Bencode bencode{nullptr, makeBenchmarkParser()};
       ParseStatus status = bencode.parse(source);
       const auto parseEnd = high_resolution_clock::now();
       const double parseTime = duration<double>(parseEnd - parseStart).count();
@@ -282,6 +436,8 @@ int main(int argc, char *argv[]) {
     parseSeconds = runParseBenchmark(iterations);
   } else if (mode == BenchmarkMode::StringifyOnly) {
     stringifySeconds = runStringifyBenchmark(iterations);
+  } else if (mode != BenchmarkMode::Roundtrip) {
+    stringifySeconds = runConvertBenchmark(iterations);
   } else {
     auto result = runRoundtripBenchmark(iterations);
     parseSeconds = result.first;
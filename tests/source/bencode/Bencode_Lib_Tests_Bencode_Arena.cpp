@@ -0,0 +1,124 @@
+#include "Bencode_Lib_Tests.hpp"
+
+// Upstream resource that counts the arena blocks outstanding
+class Counting_Resource final : public std::pmr::memory_resource {
+public:
+  std::size_t blocks = 0;
+  std::size_t outstanding = 0;
+
+private:
+  void *do_allocate(const std::size_t bytes,
+                    const std::size_t alignment) override {
+    ++blocks;
+    ++outstanding;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void *block, const std::size_t bytes,
+                     const std::size_t alignment) override {
+    --outstanding;
+    std::pmr::new_delete_resource()->deallocate(block, bytes, alignment);
+  }
+  [[nodiscard]] bool
+  do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+TEST_CASE("Bencode documents with an arena.", "[Bencode][Arena]") {
+  SECTION("Parse torrent files into an arena.", "[Bencode][Arena]") {
+    auto [fileName] =
+        GENERATE(table<std::string>({kSingleFileTorrent, kMultiFileTorrent}));
+    const std::string encoded{
+        readBencodedBytesFromFile(prefixTestDataPath(fileName))};
+    Counting_Resource upstream;
+    {
+      const Bencode bencode{ArenaOptions{4096, false, &upstream}};
+      ObjectPool<Dictionary>::resetStats();
+      bencode.parse(BufferSource{encoded});
+      // Containers came from the arena, not the node pools
+      REQUIRE(ObjectPool<Dictionary>::getStats().acquired == 0);
+      REQUIRE(upstream.outstanding > 0);
+      BufferDestination destination;
+      bencode.stringify(destination);
+      REQUIRE(destination.toString() == encoded);
+    }
+    REQUIRE(upstream.outstanding == 0);
+  }
+  SECTION("Parsing again releases the previous tree's memory.",
+          "[Bencode][Arena]") {
+    Counting_Resource upstream;
+    const Bencode bencode{ArenaOptions{1024, false, &upstream}};
+    std::string encoded{"l"};
+    for (int item = 0; item < 1000; ++item) {
+      encoded += "d3:key12:string valuee";
+    }
+    encoded += "e";
+    bencode.parse(BufferSource{encoded});
+    const std::size_t blocks = upstream.outstanding;
+    bencode.parse(BufferSource{encoded});
+    REQUIRE(upstream.outstanding <= blocks);
+    REQUIRE(NRef<List>(bencode.root()).size() == 1000);
+  }
+  SECTION("Nodes added after parsing may mix arena and heap memory.",
+          "[Bencode][Arena]") {
+    Bencode bencode{ArenaOptions{}};
+    bencode.parse(BufferSource{"d1:ai1ee"});
+    bencode["b"] = "a string too long for the small string buffer";
+    bencode["c"]["d"] = 2;
+    BufferDestination destination;
+    bencode.stringify(destination);
+    REQUIRE(destination.toString() ==
+            "d1:ai1e1:b45:a string too long for the small string buffer1:cd1:"
+            "di2eee");
+  }
+  SECTION("Huge page backed arena.", "[Bencode][Arena]") {
+    const Bencode bencode{ArenaOptions{64 * 1024, true}};
+    bencode.parse(FileSource{prefixTestDataPath(kMultiFileTorrent)});
+    BufferDestination destination;
+    bencode.stringify(destination);
+    REQUIRE(destination.toString() ==
+            readBencodedBytesFromFile(prefixTestDataPath(kMultiFileTorrent)));
+#if defined(__linux__)
+    // Blocks start on a huge page boundary so they can be promoted
+    Bencode_Arena arena{ArenaOptions{64 * 1024, true}};
+    const auto first =
+        reinterpret_cast<std::uintptr_t>(arena.resource()->allocate(64, 64));
+    REQUIRE(first % (2 * 1024 * 1024) == 0);
+#endif
+  }
+  SECTION("Nodes made inside an arena scope use the arena.",
+          "[Bencode][Arena]") {
+    Counting_Resource upstream;
+    {
+      Bencode_Arena arena{ArenaOptions{1024, false, &upstream}};
+      const Bencode_Arena::Scope scope{&arena};
+      REQUIRE(Bencode_Arena::current() == arena.resource());
+      const Node node = Node::make<String>(std::string(2000, 'x'));
+      REQUIRE(upstream.blocks > 0);
+    }
+    REQUIRE(upstream.outstanding == 0);
+    REQUIRE(Bencode_Arena::current() == nullptr);
+  }
+  SECTION("Strings and keys are moved in unless an arena is active.",
+          "[Bencode][Arena]") {
+    std::string payload(2000, 'x');
+    const char *bytes = payload.data();
+    const String string{std::move(payload)};
+    REQUIRE(string.value().data() == bytes);
+    REQUIRE_FALSE(string.isArena());
+    std::string key(100, 'k');
+    bytes = key.data();
+    const Dictionary::Entry entry{std::move(key), Node::make<Integer>(1)};
+    REQUIRE(entry.getKey().data() == bytes);
+    Bencode_Arena arena{ArenaOptions{1024, false}};
+    const Bencode_Arena::Scope scope{&arena};
+    const Dictionary::Entry arenaEntry{std::string(100, 'k'),
+                                       Node::make<Integer>(1)};
+    REQUIRE(arenaEntry.key.isArena());
+    REQUIRE(arenaEntry.getKey() == std::string(100, 'k'));
+  }
+  SECTION("Strings add no storage over a std::string.", "[Bencode][Arena]") {
+    REQUIRE(sizeof(String) <= sizeof(std::string) + sizeof(void *));
+    REQUIRE(sizeof(Dictionary::Entry) <= sizeof(String) + sizeof(Node));
+  }
+}
@@ -122,4 +122,38 @@ TEST_CASE("IDestination (Buffer interface).", "[Bencode][IDestination]") {
     bencode.stringify(buffer);
     REQUIRE(buffer.toString() == "li7ee");
   }
-}
\ No newline at end of file
+  SECTION("Release moves the encoding out and empties the buffer.",
+          "[Bencode][IDestination]") {
+    BufferDestination buffer;
+    buffer.reserve(11);
+    buffer.add("li1ei2ei3ee");
+    REQUIRE(buffer.view() == "li1ei2ei3ee");
+    const std::string encoded = buffer.release();
+    REQUIRE(encoded == "li1ei2ei3ee");
+    REQUIRE(buffer.size() == 0);
+  }
+}
+
+TEST_CASE("IDestination (Container interface).", "[Bencode][IDestination]") {
+  SECTION("Append to a caller supplied string.", "[Bencode][IDestination]") {
+    std::string encoded{"prefix"};
+    ContainerDestination destination{encoded};
+    destination.add('l');
+    destination.add(std::string{"i1e"});
+    destination.add(std::string_view{"3:abc"});
+    destination.add("e");
+    REQUIRE(encoded == "prefixli1e3:abce");
+    REQUIRE(destination.last() == 'e');
+    destination.clear();
+    REQUIRE(encoded == "prefix");
+  }
+  SECTION("Append to a caller supplied character vector.",
+          "[Bencode][IDestination]") {
+    std::vector<char> encoded;
+    ContainerDestination destination{encoded};
+    destination.reserve(4);
+    destination.add("i42e");
+    REQUIRE(std::string_view(encoded.data(), encoded.size()) == "i42e");
+    REQUIRE(encoded.capacity() >= 4);
+  }
+}
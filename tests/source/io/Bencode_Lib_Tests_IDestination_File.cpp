@@ -154,4 +154,52 @@ TEST_CASE("IDestination (File interface).", "[Bencode][IDestination]") {
     REQUIRE(NRef<Integer>(bencode2["count"]).value() == 7);
     std::filesystem::remove(file.getFileName());
   }
-}
\ No newline at end of file
+  SECTION("Bytes are buffered until flush() and are then in the file.",
+          "[Bencode][IDestination]") {
+    FileDestination file{generateRandomFileName()};
+    file.add("li1ei2e");
+    REQUIRE(file.size() == 7);
+    REQUIRE(file.last() == 'e');
+    REQUIRE(std::filesystem::file_size(file.getFileName()) == 0);
+    file.flush();
+    REQUIRE(std::filesystem::file_size(file.getFileName()) == 7);
+    file.add('e');
+    file.sync();
+    REQUIRE(readBencodedBytesFromFile(file.getFileName()) == "li1ei2ee");
+    file.close();
+    std::filesystem::remove(file.getFileName());
+  }
+  SECTION("Writes spanning and exceeding a small buffer keep their order.",
+          "[Bencode][IDestination]") {
+    FileDestination file{generateRandomFileName(), 4};
+    std::string expected;
+    for (const std::string_view bytes :
+         {"ab", "cde", "f", "ghijklmnop", "q", "rstu", "vwxyz"}) {
+      file.add(bytes);
+      expected += bytes;
+    }
+    file.add('!');
+    expected += '!';
+    REQUIRE(file.size() == expected.size());
+    file.close();
+    REQUIRE(readBencodedBytesFromFile(file.getFileName()) == expected);
+    std::filesystem::remove(file.getFileName());
+  }
+  SECTION("clear() discards bytes that are still buffered.",
+          "[Bencode][IDestination]") {
+    FileDestination file{generateRandomFileName()};
+    file.add("i1e");
+    file.clear();
+    file.add("i2e");
+    file.close();
+    REQUIRE(readBencodedBytesFromFile(file.getFileName()) == "i2e");
+    std::filesystem::remove(file.getFileName());
+  }
+  SECTION("Writing after close() is an error.", "[Bencode][IDestination]") {
+    FileDestination file{generateRandomFileName()};
+    file.close();
+    REQUIRE_THROWS_WITH(file.add("i1e"),
+                        "IDestination Error: File output stream is not open.");
+    std::filesystem::remove(file.getFileName());
+  }
+}
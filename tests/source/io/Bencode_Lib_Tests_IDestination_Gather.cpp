@@ -0,0 +1,122 @@
+#include "Bencode_Lib_Tests.hpp"
+
+TEST_CASE("IDestination (Gather interface).", "[Bencode][IDestination][Gather]") {
+  SECTION("Create GatherDestination and add pieces of each kind.",
+          "[Bencode][IDestination][Gather]") {
+    const std::string fileName{generateRandomFileName()};
+    const std::string payload(200, 'x');
+    GatherDestination destination{fileName};
+    destination.add('l');
+    destination.add("3:");
+    destination.add(std::string{"abc"});
+    destination.add(std::string_view{"200:"});
+    destination.reference(payload);
+    destination.add('e');
+    REQUIRE(destination.size() == 211);
+    REQUIRE(destination.referencedSize() == 200);
+    REQUIRE(destination.last() == 'e');
+    destination.close();
+    REQUIRE(readBencodedBytesFromFile(fileName) ==
+            "l3:abc200:" + payload + "e");
+    std::filesystem::remove(fileName);
+  }
+  SECTION("Stringify torrent files and compare with the originals.",
+          "[Bencode][IDestination][Gather]") {
+    for (const auto &torrent : {kSingleFileTorrent, kMultiFileTorrent}) {
+      const std::string fileName{generateRandomFileName()};
+      const std::string expected{
+          readBencodedBytesFromFile(prefixTestDataPath(torrent))};
+      Bencode bencode;
+      bencode.parse(BufferSource{expected});
+      GatherDestination destination{fileName, 16};
+      Default_Stringify{}.stringify(bencode.root(), destination);
+      REQUIRE(destination.referencedSize() > 0);
+      destination.close();
+      REQUIRE(readBencodedBytesFromFile(fileName) == expected);
+      std::filesystem::remove(fileName);
+    }
+  }
+  SECTION("Small side buffer and more segments than one writev batch.",
+          "[Bencode][IDestination][Gather]") {
+    const std::string fileName{generateRandomFileName()};
+    std::vector<std::string> payloads;
+    std::string expected{"l"};
+    for (std::size_t index = 0; index < 3000; ++index) {
+      payloads.push_back(std::to_string(index) + std::string(40, 'y'));
+      expected += std::to_string(payloads.back().size()) + ":" +
+                  payloads.back();
+    }
+    expected += "e";
+    GatherDestination destination{fileName, 1, 7};
+    destination.add('l');
+    for (const auto &payload : payloads) {
+      destination.add(std::to_string(payload.size()) + ":");
+      destination.reference(payload);
+    }
+    destination.add('e');
+    destination.flush();
+    REQUIRE(destination.size() == expected.size());
+    destination.close();
+    REQUIRE(readBencodedBytesFromFile(fileName) == expected);
+    std::filesystem::remove(fileName);
+  }
+  SECTION("Views passed to add() are copied however large.",
+          "[Bencode][IDestination][Gather]") {
+    const std::string fileName{generateRandomFileName()};
+    GatherDestination destination{fileName, 1};
+    std::string scratch(300, 'a');
+    destination.add(std::string_view{scratch});
+    scratch.assign(300, 'b');
+    destination.add(std::string_view{scratch});
+    REQUIRE(destination.referencedSize() == 0);
+    destination.close();
+    REQUIRE(readBencodedBytesFromFile(fileName) ==
+            std::string(300, 'a') + std::string(300, 'b'));
+    std::filesystem::remove(fileName);
+  }
+  SECTION("Copied pieces larger than the side buffer are written at once.",
+          "[Bencode][IDestination][Gather]") {
+    const std::string fileName{generateRandomFileName()};
+    GatherDestination destination{fileName, 1024, 4};
+    destination.add("12:");
+    destination.add(std::string{"hello world!"});
+    destination.close();
+    REQUIRE(readBencodedBytesFromFile(fileName) == "12:hello world!");
+    std::filesystem::remove(fileName);
+  }
+  SECTION("Clear discards pending segments.",
+          "[Bencode][IDestination][Gather]") {
+    const std::string fileName{generateRandomFileName()};
+    GatherDestination destination{fileName};
+    destination.add("i1e");
+    destination.flush();
+    destination.add("i2e");
+    destination.clear();
+    REQUIRE(destination.size() == 0);
+    destination.add("i3e");
+    destination.close();
+    REQUIRE(readBencodedBytesFromFile(fileName) == "i1ei3e");
+    REQUIRE_THROWS_AS(destination.add('x'), IDestination::Error);
+    std::filesystem::remove(fileName);
+  }
+#if !defined(_MSC_VER)
+  SECTION("Write to a descriptor that is left open.",
+          "[Bencode][IDestination][Gather]") {
+    const std::string fileName{generateRandomFileName()};
+    FILE *file = std::fopen(fileName.c_str(), "wb");
+    REQUIRE(file != nullptr);
+    {
+      GatherDestination destination{fileno(file)};
+      destination.add("d1:ai1ee");
+    }
+    REQUIRE(std::fputs("le", file) >= 0);
+    REQUIRE(std::fclose(file) == 0);
+    REQUIRE(readBencodedBytesFromFile(fileName) == "d1:ai1eele");
+    std::filesystem::remove(fileName);
+  }
+#endif
+  SECTION("Invalid descriptor throws.", "[Bencode][IDestination][Gather]") {
+    REQUIRE_THROWS_WITH(GatherDestination(-1),
+                        "IDestination Error: Invalid output descriptor.");
+  }
+}
@@ -124,4 +124,50 @@ TEST_CASE("ISource (Buffer interface). Contains file singlefile.torrent.",
     REQUIRE_NOTHROW(bencode.parse(BufferSource{"0:"}));
     REQUIRE(NRef<String>(bencode.root()).value().empty());
   }
+  SECTION("peek() returns a window without consuming it.",
+          "[Bencode][ISource]") {
+    BufferSource source{"li1ei2ee"};
+    REQUIRE(source.peek(3) == "li1");
+    REQUIRE(source.peek(100) == "li1ei2ee");
+    REQUIRE((char)source.current() == 'l');
+  }
+  SECTION("read() copies bytes and moves past them.", "[Bencode][ISource]") {
+    BufferSource source{"5:hello"};
+    source.skip(2);
+    std::string payload(5, ' ');
+    source.read(payload.data(), payload.size());
+    REQUIRE(payload == "hello");
+    REQUIRE_FALSE(source.more());
+  }
+  SECTION("read()/skip() past the end of the buffer throws.",
+          "[Bencode][ISource]") {
+    BufferSource source{"i1e"};
+    std::string payload(4, ' ');
+    REQUIRE_THROWS_AS(source.read(payload.data(), payload.size()),
+                      ISource::Error);
+    REQUIRE_THROWS_AS(source.skip(4), ISource::Error);
+  }
+  SECTION("BufferSource borrows a string_view and reads the caller's memory.",
+          "[Bencode][ISource]") {
+    const std::string buffer{"i42e"};
+    BufferSource source{std::string_view(buffer)};
+    REQUIRE_FALSE(source.isOwning());
+    REQUIRE(source.peek(4).data() == buffer.data());
+  }
+  SECTION("BufferSource takes ownership of an rvalue string.",
+          "[Bencode][ISource]") {
+    BufferSource source{std::string("d3:keyi1ee")};
+    REQUIRE(source.isOwning());
+    Bencode bencode;
+    REQUIRE_NOTHROW(bencode.parse(source));
+    REQUIRE(NRef<Integer>(bencode["key"]).value() == 1);
+  }
+  SECTION("BufferSource borrows a span of bytes.", "[Bencode][ISource]") {
+    const std::vector<std::byte> bytes{std::byte{'3'}, std::byte{':'},
+                                       std::byte{'a'}, std::byte{'b'},
+                                       std::byte{'c'}};
+    Bencode bencode;
+    REQUIRE_NOTHROW(bencode.parse(BufferSource{std::span(bytes)}));
+    REQUIRE(NRef<String>(bencode.root()).value() == "abc");
+  }
 }
@@ -123,4 +123,74 @@ TEST_CASE("ISource (File interface).", "[Bencode][ISource]") {
     bencode.stringify(dst2);
     REQUIRE(dst1.toString() == dst2.toString());
   }
+  SECTION("peek() returns a window without consuming it.",
+          "[Bencode][ISource]") {
+    FileSource source{prefixTestDataPath(kSingleFileTorrent)};
+    source.next();
+    REQUIRE(source.peek(3) == "8:a");
+    REQUIRE(source.peek(10000).size() == 763);
+    REQUIRE((char)source.current() == '8');
+  }
+  SECTION("read()/skip() move past bytes and match character traversal.",
+          "[Bencode][ISource]") {
+    FileSource source{prefixTestDataPath(kSingleFileTorrent)};
+    source.skip(3);
+    std::string bytes(5, ' ');
+    source.read(bytes.data(), bytes.size());
+    REQUIRE(bytes == readBencodedBytesFromFile(
+                         prefixTestDataPath(kSingleFileTorrent))
+                         .substr(3, 5));
+    source.skip(756);
+    REQUIRE_FALSE(source.more());
+    REQUIRE_THROWS_AS(source.skip(1), ISource::Error);
+  }
+  SECTION("Small block size refills still parse and stringify identically.",
+          "[Bencode][ISource]") {
+    FileSource source{prefixTestDataPath(kSingleFileTorrent), 7};
+    Bencode bencode;
+    bencode.parse(source);
+    BufferDestination destination;
+    bencode.stringify(destination);
+    REQUIRE(destination.toString() ==
+            readBencodedBytesFromFile(prefixTestDataPath(kSingleFileTorrent)));
+  }
+  SECTION("read()/skip()/peek() across block boundaries and reset().",
+          "[Bencode][ISource]") {
+    const auto expected =
+        readBencodedBytesFromFile(prefixTestDataPath(kSingleFileTorrent));
+    FileSource source{prefixTestDataPath(kSingleFileTorrent), 16};
+    source.skip(10);
+    REQUIRE(source.peek(40) == expected.substr(10, 40));
+    std::string bytes(100, ' ');
+    source.read(bytes.data(), bytes.size());
+    REQUIRE(bytes == expected.substr(10, 100));
+    source.reset();
+    REQUIRE((char)source.current() == 'd');
+    bytes.resize(expected.size());
+    source.read(bytes.data(), bytes.size());
+    REQUIRE(bytes == expected);
+    REQUIRE_FALSE(source.more());
+  }
+  SECTION("FileSource over an already open stream is read but not closed.",
+          "[Bencode][ISource]") {
+    const auto expected =
+        readBencodedBytesFromFile(prefixTestDataPath(kSingleFileTorrent));
+    FILE *stream = std::tmpfile();
+    REQUIRE(stream != nullptr);
+    std::fwrite(expected.data(), 1, expected.size(), stream);
+    std::fflush(stream);
+    std::rewind(stream);
+    {
+      FileSource source{stream, "tmpfile", 32};
+      REQUIRE(source.getFileName() == "tmpfile");
+      Bencode bencode;
+      bencode.parse(source);
+      REQUIRE(isA<Dictionary>(bencode.root()));
+    }
+    REQUIRE(std::fclose(stream) == 0);
+  }
+  SECTION("FileSource over a null stream throws.", "[Bencode][ISource]") {
+    REQUIRE_THROWS_WITH(FileSource(static_cast<FILE *>(nullptr)),
+                        "ISource Error: Bencode file input stream is not open.");
+  }
 }
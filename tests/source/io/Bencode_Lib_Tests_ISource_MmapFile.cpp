@@ -0,0 +1,74 @@
+#include "Bencode_Lib_Tests.hpp"
+
+TEST_CASE("ISource (Memory mapped file interface).", "[Bencode][ISource]") {
+  SECTION("Create MmapFileSource with singlefile.torrent.",
+          "[Bencode][ISource]") {
+    REQUIRE_NOTHROW(MmapFileSource(prefixTestDataPath(kSingleFileTorrent)));
+  }
+  SECTION("Create MmapFileSource with non existant file.",
+          "[Bencode][ISource]") {
+    REQUIRE_THROWS_AS(MmapFileSource(prefixTestDataPath(kNonExistantTorrent)),
+                      ISource::Error);
+    REQUIRE_THROWS_WITH(
+        MmapFileSource(prefixTestDataPath(kNonExistantTorrent)),
+        "ISource Error: Bencode file input stream failed to "
+        "open or does not exist.");
+  }
+  SECTION("MmapFileSource maps a regular file and is positioned on the "
+          "correct first character.",
+          "[Bencode][ISource]") {
+    MmapFileSource source{prefixTestDataPath(kSingleFileTorrent)};
+    REQUIRE(source.isMapped());
+    REQUIRE(source.more());
+    REQUIRE((char)source.current() == 'd');
+    source.next();
+    REQUIRE((char)source.current() == '8');
+  }
+  SECTION("MmapFileSource contents match the file and traversal counts every "
+          "byte.",
+          "[Bencode][ISource]") {
+    MmapFileSource source{prefixTestDataPath(kSingleFileTorrent)};
+    REQUIRE(source.contents() ==
+            readBencodedBytesFromFile(prefixTestDataPath(kSingleFileTorrent)));
+    Bencode::IntegerType length = 0;
+    while (source.more()) {
+      source.next();
+      length++;
+    }
+    REQUIRE(length == 764);
+    REQUIRE(source.current() == static_cast<char>(0xff));
+    source.reset();
+    REQUIRE((char)source.current() == 'd');
+  }
+  SECTION("peek()/read()/skip() operate on the mapped buffer.",
+          "[Bencode][ISource]") {
+    MmapFileSource source{prefixTestDataPath(kSingleFileTorrent)};
+    REQUIRE(source.peek(3) == "d8:");
+    source.skip(3);
+    std::string bytes(8, ' ');
+    source.read(bytes.data(), bytes.size());
+    REQUIRE(bytes == "announce");
+    REQUIRE(source.peek(10000).size() == 753);
+    REQUIRE_THROWS_AS(source.skip(754), ISource::Error);
+  }
+  SECTION("Parse multifile.torrent via MmapFileSource and compare with "
+          "FileSource.",
+          "[Bencode][ISource]") {
+    Bencode mapped;
+    REQUIRE_NOTHROW(
+        mapped.parse(MmapFileSource{prefixTestDataPath(kMultiFileTorrent)}));
+    Bencode buffered;
+    buffered.parse(FileSource{prefixTestDataPath(kMultiFileTorrent)});
+    BufferDestination mappedOutput;
+    BufferDestination bufferedOutput;
+    mapped.stringify(mappedOutput);
+    buffered.stringify(bufferedOutput);
+    REQUIRE(mappedOutput.toString() == bufferedOutput.toString());
+  }
+  SECTION("getFileName() returns the path used to open the source.",
+          "[Bencode][ISource]") {
+    const std::string path{prefixTestDataPath(kSingleFileTorrent)};
+    MmapFileSource source{path};
+    REQUIRE(source.getFileName() == path);
+  }
+}
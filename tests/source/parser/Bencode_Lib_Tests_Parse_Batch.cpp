@@ -0,0 +1,75 @@
+#include "Bencode_Lib_Tests.hpp"
+
+TEST_CASE("Parse batches of Bencode across workers.",
+          "[Bencode][Parse][Batch]") {
+  SECTION("Buffer results are returned in input order.",
+          "[Bencode][Parse][Batch]") {
+    auto [threads] = GENERATE(table<unsigned int>({1, 4}));
+    std::vector<std::string> encoded;
+    for (int item = 0; item < 100; ++item) {
+      encoded.push_back("li" + std::to_string(item) + "ee");
+    }
+    const std::vector<std::string_view> buffers(encoded.begin(),
+                                                encoded.end());
+    const Batch_Parser batch{threads};
+    REQUIRE(batch.workers() == threads);
+    const auto results = batch.parseBuffers(buffers);
+    REQUIRE(results.size() == buffers.size());
+    for (std::size_t item = 0; item < results.size(); ++item) {
+      REQUIRE(results[item].ok());
+      REQUIRE(NRef<Integer>(results[item].root[0]).value() ==
+              static_cast<Bencode::IntegerType>(item));
+    }
+  }
+  SECTION("Failed items report a status without affecting the others.",
+          "[Bencode][Parse][Batch]") {
+    const Batch_Parser batch{3};
+    const auto results = batch.parseBuffers(
+        {"i1e", "d1:bi1e1:ai2ee", "4:spam", "i9223372036854775808e", ""});
+    REQUIRE(results[0].ok());
+    REQUIRE(results[1].status.code == ErrorCode::SyntaxError);
+    REQUIRE(results[1].status.message ==
+            "Bencode Syntax Error: Dictionary keys not in sequence.");
+    REQUIRE(NRef<String>(results[2].root).value() == "spam");
+    REQUIRE(results[3].status.code == ErrorCode::IntegerOverflow);
+    REQUIRE_FALSE(results[4].ok());
+  }
+  SECTION("Data after the value is rejected as by Bencode::parse.",
+          "[Bencode][Parse][Batch]") {
+    const Batch_Parser batch{2};
+    const auto results = batch.parseBuffers({"i1ei2e", "i1e"});
+    REQUIRE(results[0].status.code == ErrorCode::SourceTerminatedEarly);
+    REQUIRE(results[0].status.message ==
+            "Bencode Syntax Error: Source stream terminated early.");
+    REQUIRE(results[1].ok());
+  }
+  SECTION("Parse torrent files.", "[Bencode][Parse][Batch]") {
+    const Batch_Parser batch{2};
+    const auto results =
+        batch.parseFiles({prefixTestDataPath(kSingleFileTorrent),
+                          prefixTestDataPath(kNonExistantTorrent),
+                          prefixTestDataPath(kMultiFileTorrent)});
+    REQUIRE(results.size() == 3);
+    REQUIRE(results[0].ok());
+    REQUIRE(results[1].status.code == ErrorCode::IOError);
+    REQUIRE(results[2].ok());
+    BufferDestination destination;
+    Default_Stringify{}.stringify(results[2].root, destination);
+    REQUIRE(destination.toString() ==
+            readBencodedBytesFromFile(prefixTestDataPath(kMultiFileTorrent)));
+  }
+  SECTION("Borrowed strings of parsed files outlive parseFiles.",
+          "[Bencode][Parse][Batch]") {
+    const Batch_Parser batch{2, ParseOptions{StringStorage::Borrowed}};
+    const auto results =
+        batch.parseFiles({prefixTestDataPath(kSingleFileTorrent)});
+    REQUIRE(results[0].ok());
+    REQUIRE(results[0].source != nullptr);
+    const auto &announce = NRef<String>(results[0].root["announce"]);
+    REQUIRE(announce.isBorrowed());
+    BufferDestination destination;
+    Default_Stringify{}.stringify(results[0].root, destination);
+    REQUIRE(destination.toString() ==
+            readBencodedBytesFromFile(prefixTestDataPath(kSingleFileTorrent)));
+  }
+}
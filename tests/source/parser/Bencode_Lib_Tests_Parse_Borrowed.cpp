@@ -0,0 +1,115 @@
+#include "Bencode_Lib_Tests.hpp"
+
+static bool insideBuffer(const std::string_view value,
+                         const std::string &buffer) {
+  return value.data() >= buffer.data() &&
+         value.data() + value.size() <= buffer.data() + buffer.size();
+}
+
+static std::string parseError(IParser &parser, const std::string &encoded) {
+  try {
+    BufferSource source{std::string_view(encoded)};
+    [[maybe_unused]] auto root = parser.parse(source);
+  } catch (const std::exception &ex) {
+    return ex.what();
+  }
+  return "";
+}
+
+TEST_CASE("Parse with borrowed strings and keys.",
+          "[Bencode][Parse][Borrowed]") {
+  const std::string encoded{"d4:infod4:name8:file.txte5:pieceli1e6:abcdefee"};
+  SECTION("Strings and keys view the source buffer.",
+          "[Bencode][Parse][Borrowed]") {
+    const Bencode bencode{nullptr,
+                          makeParser<Default_Parser>(StringStorage::Borrowed)};
+    bencode.parse(BufferSource{std::string_view(encoded)});
+    const auto &info = NRef<Dictionary>(bencode["info"]);
+    REQUIRE(info.value()[0].isBorrowed());
+    REQUIRE(insideBuffer(info.value()[0].getKey(), encoded));
+    const auto &name = NRef<String>(bencode["info"]["name"]);
+    REQUIRE(name.isBorrowed());
+    REQUIRE(name.value() == "file.txt");
+    REQUIRE(insideBuffer(name.value(), encoded));
+    REQUIRE(NRef<String>(bencode["piece"][1]).isBorrowed());
+    BufferDestination destination;
+    bencode.stringify(destination);
+    REQUIRE(destination.toString() == encoded);
+  }
+  SECTION("Sources that are not stable are copied.",
+          "[Bencode][Parse][Borrowed]") {
+    const Bencode bencode{nullptr,
+                          makeParser<Default_Parser>(StringStorage::Borrowed)};
+    bencode.parse(BufferSource{std::string(encoded)});
+    REQUIRE_FALSE(NRef<String>(bencode["info"]["name"]).isBorrowed());
+    REQUIRE_FALSE(NRef<Dictionary>(bencode.root()).value()[0].isBorrowed());
+    bencode.parse(FileSource{prefixTestDataPath(kSingleFileTorrent)});
+    REQUIRE_FALSE(NRef<String>(bencode["announce"]).isBorrowed());
+  }
+  SECTION("Writing to a borrowed string promotes it first.",
+          "[Bencode][Parse][Borrowed]") {
+    std::string buffer{encoded};
+    Bencode bencode{nullptr,
+                    makeParser<Default_Parser>(StringStorage::Borrowed)};
+    bencode.parse(BufferSource{std::string_view(buffer)});
+    auto &name = NRef<String>(bencode["info"]["name"]);
+    name.data()[0] = 'F';
+    REQUIRE_FALSE(name.isBorrowed());
+    REQUIRE(name.value() == "File.txt");
+    REQUIRE(buffer == encoded);
+    auto &piece = NRef<String>(bencode["piece"][1]);
+    piece.assign("xyz");
+    REQUIRE_FALSE(piece.isBorrowed());
+    REQUIRE(piece.value() == "xyz");
+  }
+  SECTION("Promoting the tree lets the source buffer be released.",
+          "[Bencode][Parse][Borrowed]") {
+    auto buffer = std::make_unique<std::string>(encoded);
+    Bencode bencode{nullptr,
+                    makeParser<Default_Parser>(StringStorage::Borrowed)};
+    bencode.parse(BufferSource{std::string_view(*buffer)});
+    bencode.promote();
+    REQUIRE_FALSE(NRef<Dictionary>(bencode.root()).value()[1].isBorrowed());
+    REQUIRE_FALSE(NRef<String>(bencode["info"]["name"]).isBorrowed());
+    buffer->assign(buffer->size(), 'x');
+    buffer.reset();
+    BufferDestination destination;
+    bencode.stringify(destination);
+    REQUIRE(destination.toString() == encoded);
+  }
+  SECTION("Torrent files parse identically to owned strings.",
+          "[Bencode][Parse][Borrowed]") {
+    auto [fileName] =
+        GENERATE(table<std::string>({kSingleFileTorrent, kMultiFileTorrent}));
+    const std::string torrent{
+        readBencodedBytesFromFile(prefixTestDataPath(fileName))};
+    const Bencode bencode{nullptr,
+                          makeParser<Default_Parser>(StringStorage::Borrowed)};
+    bencode.parse(BufferSource{std::string_view(torrent)});
+    REQUIRE(NRef<String>(bencode["info"]["pieces"]).isBorrowed());
+    BufferDestination destination;
+    bencode.stringify(destination);
+    REQUIRE(destination.toString() == torrent);
+  }
+  SECTION("Memory mapped files are borrowed while the source is kept.",
+          "[Bencode][Parse][Borrowed]") {
+    MmapFileSource source{prefixTestDataPath(kSingleFileTorrent)};
+    const Bencode bencode{nullptr,
+                          makeParser<Default_Parser>(StringStorage::Borrowed)};
+    bencode.parse(source);
+    REQUIRE(NRef<String>(bencode["announce"]).isBorrowed());
+    REQUIRE(NRef<String>(bencode["announce"]).value().data() >=
+            source.contents().data());
+  }
+  SECTION("Malformed encodings report the same errors as owned strings.",
+          "[Bencode][Parse][Borrowed]") {
+    auto [malformed] = GENERATE(table<std::string>(
+        {"26:abcdefghijklmno", "-3:abc", "3abc", "d1:bi1e1:ai2ee",
+         "d1:ai1e1:ai2ee", "d3:abc", "l5:abe", "di1ei2ee"}));
+    Default_Parser ownedParser;
+    Default_Parser borrowedParser{StringStorage::Borrowed};
+    const std::string expected = parseError(ownedParser, malformed);
+    REQUIRE_FALSE(expected.empty());
+    REQUIRE(parseError(borrowedParser, malformed) == expected);
+  }
+}
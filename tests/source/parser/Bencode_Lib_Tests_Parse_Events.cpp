@@ -0,0 +1,111 @@
+#include "Bencode_Lib_Tests.hpp"
+
+// Records each event as a short token so sequences compare as strings
+class Event_Recorder final : public IParseHandler {
+public:
+  void onInteger(const std::int64_t value) override {
+    events += 'i';
+    events += std::to_string(value);
+    events += ' ';
+  }
+  void onString(const std::string_view value) override {
+    events += 's';
+    events.append(value);
+    events += ' ';
+  }
+  void onListBegin() override { events += "[ "; }
+  void onListEnd() override { events += "] "; }
+  void onDictionaryBegin() override { events += "{ "; }
+  void onDictionaryEnd() override { events += "} "; }
+  void onKey(const std::string_view key) override {
+    events += 'k';
+    events.append(key);
+    events += ' ';
+  }
+  std::string events;
+};
+
+TEST_CASE("Parse Bencode into handler events.", "[Bencode][Parse][Events]") {
+  SECTION("Scalars raise a single event.", "[Bencode][Parse][Events]") {
+    Event_Parser parser;
+    Event_Recorder recorder;
+    parser.parse(BufferSource{"i-266e"}, recorder);
+    parser.parse(BufferSource{"12:qwertyuiopas"}, recorder);
+    parser.parse(BufferSource{"0:"}, recorder);
+    REQUIRE(recorder.events == "i-266 sqwertyuiopas s ");
+  }
+  SECTION("Containers raise events in document order.",
+          "[Bencode][Parse][Events]") {
+    Event_Parser parser;
+    Event_Recorder recorder;
+    parser.parse(BufferSource{"d3:onei1e5:threel1:ali2eee3:twod1:xdeee"},
+                 recorder);
+    REQUIRE(recorder.events ==
+            "{ kone i1 kthree [ sa [ i2 ] ] ktwo { kx { } } } ");
+  }
+  SECTION("Strings on contiguous sources are passed in place.",
+          "[Bencode][Parse][Events]") {
+    struct View_Handler final : IParseHandler {
+      void onString(const std::string_view value) override { view = value; }
+      std::string_view view;
+    } handler;
+    const std::string encoded{"5:hello"};
+    Event_Parser parser;
+    parser.parse(BufferSource{encoded}, handler);
+    REQUIRE(handler.view == "hello");
+  }
+  SECTION("Events from torrent files match the parsed tree.",
+          "[Bencode][Parse][Events]") {
+    auto [fileName] =
+        GENERATE(table<std::string>({kSingleFileTorrent, kMultiFileTorrent}));
+    Event_Parser parser;
+    Event_Recorder fromBuffer;
+    Event_Recorder fromFile;
+    parser.parse(BufferSource{readBencodedBytesFromFile(
+                     prefixTestDataPath(fileName))},
+                 fromBuffer);
+    parser.parse(FileSource{prefixTestDataPath(fileName), 16}, fromFile);
+    REQUIRE(fromBuffer.events == fromFile.events);
+    const Bencode bencode;
+    bencode.parse(FileSource{prefixTestDataPath(fileName)});
+    REQUIRE(fromBuffer.events.find(
+                "kname s" +
+                std::string(NRef<String>(bencode["info"]["name"]).value()) +
+                " ") != std::string::npos);
+  }
+  SECTION("Malformed input reports the same errors as the default parser.",
+          "[Bencode][Parse][Events]") {
+    auto [encoded] = GENERATE(table<std::string>(
+        {"", "x", "d1:bi1e1:ai2ee", "d1:ai1e1:ai2ee", "i12", "li1e",
+         "-5:hello", "5hello", "i01e", "i-0e", "d1:ae", "de", "l3:abe"}));
+    Event_Parser parser;
+    IParseHandler handler;
+    std::string expected;
+    std::string actual;
+    try {
+      const Bencode bencode;
+      bencode.parse(BufferSource{encoded});
+    } catch (const std::exception &ex) {
+      expected = ex.what();
+    }
+    try {
+      parser.parse(BufferSource{encoded}, handler);
+    } catch (const std::exception &ex) {
+      actual = ex.what();
+    }
+    REQUIRE(actual == expected);
+    REQUIRE_THROWS_AS(
+        parser.parse(BufferSource{"i9223372036854775808e"}, handler),
+        std::out_of_range);
+  }
+  SECTION("Nesting is limited by the default parser depth.",
+          "[Bencode][Parse][Events]") {
+    Event_Parser parser;
+    IParseHandler handler;
+    const auto maxDepth = Default_Parser::getMaxParserDepth();
+    const std::string encoded =
+        std::string(maxDepth, 'l') + std::string(maxDepth, 'e');
+    REQUIRE_THROWS_WITH(parser.parse(BufferSource{encoded}, handler),
+                        "Bencode Syntax Error: Maximum parser depth exceeded.");
+  }
+}
@@ -0,0 +1,71 @@
+#include "Bencode_Lib_Tests.hpp"
+
+TEST_CASE("Extract key paths without building a tree.",
+          "[Bencode][Parse][Extract]") {
+  SECTION("Extract torrent metadata fields.", "[Bencode][Parse][Extract]") {
+    const std::string encoded{
+        readBencodedBytesFromFile(prefixTestDataPath(kSingleFileTorrent))};
+    const Bencode bencode;
+    bencode.parse(BufferSource{encoded});
+    Path_Extractor extractor{"announce", "info.name", "info.piece length"};
+    extractor.extract(BufferSource{encoded});
+    REQUIRE(extractor.size() == 3);
+    REQUIRE(NRef<String>(extractor[0]).value() ==
+            NRef<String>(bencode["announce"]).value());
+    REQUIRE(NRef<String>(extractor[1]).value() ==
+            NRef<String>(bencode["info"]["name"]).value());
+    REQUIRE(NRef<Integer>(extractor[2]).value() ==
+            NRef<Integer>(bencode["info"]["piece length"]).value());
+  }
+  SECTION("Missing paths are reported as not found.",
+          "[Bencode][Parse][Extract]") {
+    Path_Extractor extractor{"a.x", "b", "c.d"};
+    extractor.extract(BufferSource{"d1:ad1:yi1ee1:bli1ei2ee1:ci3ee"});
+    REQUIRE_FALSE(extractor.found(0));
+    REQUIRE(extractor.found(1));
+    REQUIRE(NRef<List>(extractor[1]).size() == 2);
+    REQUIRE_FALSE(extractor.found(2));
+    REQUIRE_THROWS_WITH(extractor[0],
+                        "Path_Extractor Error: No value found for key path.");
+  }
+  SECTION("Nested and root paths share one materialized value.",
+          "[Bencode][Parse][Extract]") {
+    Path_Extractor extractor{"info", "info.length", ""};
+    extractor.extract(
+        BufferSource{"d4:infod6:lengthi1024e4:name8:file.txtee"});
+    REQUIRE(isA<Dictionary>(extractor[0]));
+    REQUIRE(NRef<Integer>(extractor[1]).value() == 1024);
+    REQUIRE(isA<Dictionary>(extractor[2]));
+  }
+  SECTION("Extraction stops once every path is resolved.",
+          "[Bencode][Parse][Extract]") {
+    // Everything after "name" is malformed but never read
+    Path_Extractor extractor{"name"};
+    BufferSource source{"d4:name4:test6:piecesXXXX"};
+    extractor.extract(source);
+    REQUIRE(NRef<String>(extractor[0]).value() == "test");
+    REQUIRE(source.current() == '6');
+  }
+  SECTION("Keys given as explicit paths may contain the separator.",
+          "[Bencode][Parse][Extract]") {
+    Path_Extractor extractor{std::vector<Path_Extractor::Path>{{"a.b"}}};
+    extractor.extract(BufferSource{"d3:a.bi5ee"});
+    REQUIRE(NRef<Integer>(extractor[0]).value() == 5);
+  }
+  SECTION("Malformed skipped values raise syntax errors.",
+          "[Bencode][Parse][Extract]") {
+    Path_Extractor extractor{"z"};
+    REQUIRE_THROWS_WITH(extractor.extract(BufferSource{"d1:ai01e1:zi1ee"}),
+                        "Bencode Syntax Error: Empty Integer or has leading "
+                        "zero.");
+    REQUIRE_THROWS_AS(extractor.extract(BufferSource{"d1:a5:abc"}),
+                      ISource::Error);
+  }
+  SECTION("Extract from a block buffered FileSource.",
+          "[Bencode][Parse][Extract]") {
+    Path_Extractor extractor{"info.length", "info.pieces"};
+    extractor.extract(FileSource{prefixTestDataPath(kSingleFileTorrent), 16});
+    REQUIRE(extractor.found(0));
+    REQUIRE(isA<String>(extractor[1]));
+  }
+}
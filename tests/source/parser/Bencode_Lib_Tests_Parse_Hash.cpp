@@ -0,0 +1,124 @@
+#include "Bencode_Lib_Tests.hpp"
+
+static std::string hexDigest(const HashAlgorithm algorithm,
+                             const std::string_view message) {
+  Hasher hasher{algorithm};
+  hasher.update(message);
+  return Hasher::toHex(hasher.digest());
+}
+
+static std::string parseDigest(ISource &source, const ParseOptions &options) {
+  Default_Parser parser{options};
+  [[maybe_unused]] auto root = parser.parse(source);
+  return Hasher::toHex(parser.digest());
+}
+
+TEST_CASE("Hash messages with SHA-1 and SHA-256.", "[Bencode][Hash]") {
+  SECTION("Known SHA-1 digests.", "[Bencode][Hash]") {
+    REQUIRE(hexDigest(HashAlgorithm::SHA1, "") ==
+            "da39a3ee5e6b4b0d3255bfef95601890afd80709");
+    REQUIRE(hexDigest(HashAlgorithm::SHA1, "abc") ==
+            "a9993e364706816aba3e25717850c26c9cd0d89d");
+    REQUIRE(hexDigest(HashAlgorithm::SHA1,
+                      "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq") ==
+            "84983e441c3bd26ebaae4aa1f95129e5e54670f1");
+  }
+  SECTION("Known SHA-256 digests.", "[Bencode][Hash]") {
+    REQUIRE(hexDigest(HashAlgorithm::SHA256, "") ==
+            "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    REQUIRE(hexDigest(HashAlgorithm::SHA256, "abc") ==
+            "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    REQUIRE(hexDigest(HashAlgorithm::SHA256,
+                      "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq") ==
+            "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+  }
+  SECTION("Message fed in pieces hashes the same as in one update.",
+          "[Bencode][Hash]") {
+    const std::string message(1000000, 'a');
+    Hasher hasher{HashAlgorithm::SHA1};
+    for (std::size_t offset = 0; offset < message.size(); offset += 997) {
+      hasher.update(std::string_view(message).substr(offset, 997));
+    }
+    REQUIRE(Hasher::toHex(hasher.digest()) ==
+            "34aa973cd4c4daa4f61eeb2bdbad27316534016f");
+    hasher.update('a');
+    hasher.update(std::string_view("bc"));
+    REQUIRE(Hasher::toHex(hasher.digest()) ==
+            "a9993e364706816aba3e25717850c26c9cd0d89d");
+  }
+}
+
+TEST_CASE("Hash a key path while parsing.", "[Bencode][Parse][Hash]") {
+  SECTION("Torrent info-hash from a buffer.", "[Bencode][Parse][Hash]") {
+    const std::string encoded{
+        readBencodedBytesFromFile(prefixTestDataPath(kSingleFileTorrent))};
+    BufferSource source{std::string_view(encoded)};
+    REQUIRE(parseDigest(source, {.hash = HashAlgorithm::SHA1,
+                                 .hashPath = {"info"}}) ==
+            "7fd1a2631b385a4cc68bf15040fa375c8e68cb7e");
+    source.reset();
+    REQUIRE(parseDigest(source, {.hash = HashAlgorithm::SHA256,
+                                 .hashPath = {"info"}}) ==
+            "ea7451b02ab828b04e476f58b8f52c48cbbd35333f6a53dec468b60a64a0d350");
+  }
+  SECTION("Torrent info-hash from a file read in small blocks.",
+          "[Bencode][Parse][Hash]") {
+    FileSource source{prefixTestDataPath(kMultiFileTorrent), 64};
+    REQUIRE(parseDigest(source, {.hash = HashAlgorithm::SHA1,
+                                 .hashPath = {"info"}}) ==
+            "c28bf4c5ab095923eecad46701d09408912928e7");
+  }
+  SECTION("Info-hash matches hashing the re-encoded info dictionary.",
+          "[Bencode][Parse][Hash]") {
+    Bencode bencode;
+    bencode.parse(FileSource{prefixTestDataPath(kMultiFileTorrent)});
+    BufferDestination destination;
+    Default_Stringify{}.stringify(bencode["info"], destination);
+    MmapFileSource source{prefixTestDataPath(kMultiFileTorrent)};
+    REQUIRE(parseDigest(source, {.strings = StringStorage::Borrowed,
+                                 .hash = HashAlgorithm::SHA256,
+                                 .hashPath = {"info"}}) ==
+            hexDigest(HashAlgorithm::SHA256, destination.toString()));
+  }
+  SECTION("Nested path, scalar target and whole document.",
+          "[Bencode][Parse][Hash]") {
+    const std::string encoded{"d1:ad1:bli1e2:xyee1:ci42ee"};
+    BufferSource source{std::string_view(encoded)};
+    REQUIRE(parseDigest(source, {.hash = HashAlgorithm::SHA1,
+                                 .hashPath = {"a", "b"}}) ==
+            hexDigest(HashAlgorithm::SHA1, "li1e2:xye"));
+    source.reset();
+    REQUIRE(parseDigest(source, {.hash = HashAlgorithm::SHA1,
+                                 .hashPath = {"c"}}) ==
+            hexDigest(HashAlgorithm::SHA1, "i42e"));
+    source.reset();
+    REQUIRE(parseDigest(source, {.hash = HashAlgorithm::SHA1}) ==
+            hexDigest(HashAlgorithm::SHA1, encoded));
+  }
+  SECTION("Missing key path gives an empty digest.",
+          "[Bencode][Parse][Hash]") {
+    const std::string encoded{"d1:ad1:bi1eee"};
+    BufferSource source{std::string_view(encoded)};
+    REQUIRE(parseDigest(source, {.hash = HashAlgorithm::SHA1,
+                                 .hashPath = {"b"}})
+                .empty());
+    source.reset();
+    REQUIRE(parseDigest(source, {.hash = HashAlgorithm::SHA1,
+                                 .hashPath = {"a", "b", "c"}})
+                .empty());
+    source.reset();
+    REQUIRE(parseDigest(source, {.hashPath = {"a"}}).empty());
+  }
+  SECTION("Batch results carry the info-hash.", "[Bencode][Parse][Hash]") {
+    const Batch_Parser batch{
+        2, {.hash = HashAlgorithm::SHA1, .hashPath = {"info"}}};
+    const auto results =
+        batch.parseFiles({prefixTestDataPath(kSingleFileTorrent),
+                          prefixTestDataPath(kMultiFileTorrent)});
+    REQUIRE(results[0].ok());
+    REQUIRE(Hasher::toHex(results[0].digest) ==
+            "7fd1a2631b385a4cc68bf15040fa375c8e68cb7e");
+    REQUIRE(Hasher::toHex(results[1].digest) ==
+            "c28bf4c5ab095923eecad46701d09408912928e7");
+  }
+}
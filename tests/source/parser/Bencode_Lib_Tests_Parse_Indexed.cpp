@@ -0,0 +1,135 @@
+#include "Bencode_Lib_Tests.hpp"
+
+static std::string parseError(IParser &parser, const std::string &encoded) {
+  try {
+    BufferSource source{encoded};
+    [[maybe_unused]] auto root = parser.parse(source);
+  } catch (const std::exception &ex) {
+    return ex.what();
+  }
+  return "";
+}
+
+TEST_CASE("Parse using the indexed parser.", "[Bencode][Parse][Indexed]") {
+  SECTION("Parse valid encodings and stringify identically to the default "
+          "parser.",
+          "[Bencode][Parse][Indexed]") {
+    auto [encoded] = GENERATE(table<std::string>(
+        {"i0e", "i-9223372036854775808e", "0:", "12:qwertyuiopas", "le", "de",
+         "li1ei2ei3ee", "d1:ai1e1:bli2e2:xyee", "ld3:keyi1eel0:ee",
+         "d4:infod6:lengthi1024e4:name8:file.txtee"}));
+    const Bencode defaultBencode;
+    const Bencode indexedBencode{nullptr, makeParser<Indexed_Parser>()};
+    defaultBencode.parse(BufferSource{encoded});
+    indexedBencode.parse(BufferSource{encoded});
+    BufferDestination defaultDestination;
+    BufferDestination indexedDestination;
+    defaultBencode.stringify(defaultDestination);
+    indexedBencode.stringify(indexedDestination);
+    REQUIRE(indexedDestination.toString() == encoded);
+    REQUIRE(indexedDestination.toString() == defaultDestination.toString());
+  }
+  SECTION("Parse torrent files identically to the default parser.",
+          "[Bencode][Parse][Indexed]") {
+    auto [fileName] =
+        GENERATE(table<std::string>({kSingleFileTorrent, kMultiFileTorrent}));
+    const std::string encoded{
+        readBencodedBytesFromFile(prefixTestDataPath(fileName))};
+    const Bencode bencode{nullptr, makeParser<Indexed_Parser>()};
+    bencode.parse(BufferSource{encoded});
+    BufferDestination destination;
+    bencode.stringify(destination);
+    REQUIRE(destination.toString() == encoded);
+  }
+  SECTION("Malformed encodings report the same errors as the default parser.",
+          "[Bencode][Parse][Indexed]") {
+    auto [encoded] = GENERATE(table<std::string>(
+        {"", "i266", "i-0e", "i01e", "ie", "i9223372036854775808e",
+         "i123456789012345678901e", "26:abcdefghijklmno", "3abc", "-3:abc",
+         "li266ei6780ei88e", "d1:bi1e1:ai2ee", "d1:ai1e1:ai2ee", "di1ei2ee",
+         "e", "x", "llllllllllllleeeeeeeeeeeee", "d1:ae", "d1:ad1:bee"}));
+    Default_Parser defaultParser;
+    Indexed_Parser indexedParser;
+    const std::string expected = parseError(defaultParser, encoded);
+    REQUIRE_FALSE(expected.empty());
+    REQUIRE(parseError(indexedParser, encoded) == expected);
+  }
+  SECTION("Source is left positioned just past the parsed value.",
+          "[Bencode][Parse][Indexed]") {
+    BufferSource source{"li1ei2eei3e"};
+    Indexed_Parser parser;
+    [[maybe_unused]] auto root = parser.parse(source);
+    REQUIRE(source.current() == 'i');
+  }
+  SECTION("Parse from a block buffered FileSource.",
+          "[Bencode][Parse][Indexed]") {
+    // Not contiguous, so parsed by the default parser a block at a time
+    FileSource source{prefixTestDataPath(kSingleFileTorrent), 16};
+    REQUIRE_FALSE(source.contiguous());
+    REQUIRE(BufferSource{"i1e"}.contiguous());
+    const Bencode bencode{nullptr, makeParser<Indexed_Parser>()};
+    bencode.parse(source);
+    BufferDestination destination;
+    bencode.stringify(destination);
+    REQUIRE(destination.toString() ==
+            readBencodedBytesFromFile(prefixTestDataPath(kSingleFileTorrent)));
+  }
+  SECTION("Large outermost containers parse the same across threads.",
+          "[Bencode][Parse][Indexed]") {
+    std::string list{"l"};
+    std::string dictionary{"d"};
+    for (std::size_t element = 0;
+         element < 3 * Indexed_Parser::kMinParallelElements; ++element) {
+      const std::string key = std::to_string(100000 + element);
+      list += "li" + std::to_string(element) + "e5:valuee";
+      dictionary += std::to_string(key.size()) + ":" + key + "d1:xi" +
+                    std::to_string(element) + "ee";
+    }
+    list += "e";
+    dictionary += "e";
+    auto [encoded] = GENERATE_COPY(table<std::string>({list, dictionary}));
+    const Bencode bencode{nullptr, makeParser<Indexed_Parser>(4u)};
+    bencode.parse(BufferSource{encoded});
+    BufferDestination destination;
+    bencode.stringify(destination);
+    REQUIRE(destination.toString() == encoded);
+  }
+  SECTION("Threaded parse reports the same errors as the default parser.",
+          "[Bencode][Parse][Indexed]") {
+    std::string encoded{"d"};
+    for (std::size_t element = 0;
+         element < 2 * Indexed_Parser::kMinParallelElements; ++element) {
+      // Last key repeats the one before it
+      const std::string key = std::to_string(
+          100000 + std::min(element,
+                            2 * Indexed_Parser::kMinParallelElements - 2));
+      encoded += std::to_string(key.size()) + ":" + key + "i1e";
+    }
+    encoded += "e";
+    Default_Parser defaultParser;
+    Indexed_Parser indexedParser{4};
+    const std::string expected = parseError(defaultParser, encoded);
+    REQUIRE(expected == "Bencode Syntax Error: Duplicate dictionary key.");
+    REQUIRE(parseError(indexedParser, encoded) == expected);
+    // Element that fails inside a worker thread
+    std::string list{"l"};
+    for (std::size_t element = 0;
+         element < 2 * Indexed_Parser::kMinParallelElements; ++element) {
+      list += "li1ee";
+    }
+    list += "li9223372036854775808eee";
+    REQUIRE(parseError(indexedParser, list) == "Integer conversion overflow.");
+    // Root dictionary whose last key has no value
+    std::string missing{"d"};
+    for (std::size_t element = 0;
+         element < 2 * Indexed_Parser::kMinParallelElements; ++element) {
+      missing += "6:" + std::to_string(100000 + element) + "i1e";
+    }
+    missing += "6:999999e";
+    REQUIRE(parseError(indexedParser, missing) ==
+            parseError(defaultParser, missing));
+    REQUIRE(parseError(indexedParser, missing) ==
+            "Bencode Syntax Error: Expected integer or string while parsing "
+            "container.");
+  }
+}
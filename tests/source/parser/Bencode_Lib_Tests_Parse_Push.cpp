@@ -0,0 +1,96 @@
+#include "Bencode_Lib_Tests.hpp"
+
+// Feed encoded Bencode in fixed size chunks and re-encode the value
+static std::string pushParse(const std::string_view encoded,
+                             const std::size_t chunkSize) {
+  Push_Parser parser;
+  for (std::size_t offset = 0; offset < encoded.size(); offset += chunkSize) {
+    REQUIRE_FALSE(parser.complete());
+    parser.feed(encoded.substr(offset, chunkSize));
+  }
+  REQUIRE(parser.complete());
+  BufferDestination destination;
+  Default_Stringify{}.stringify(parser.take(), destination);
+  return destination.toString();
+}
+
+TEST_CASE("Parse Bencode fed in chunks.", "[Bencode][Parse][Push]") {
+  SECTION("Values split at every position parse the same.",
+          "[Bencode][Parse][Push]") {
+    auto [encoded] = GENERATE(table<std::string>(
+        {"i-266e", "12:qwertyuiopas", "0:", "le", "de",
+         "d3:onei1e5:threel1:ali2eee3:twod1:x0:ee",
+         "li9223372036854775807ei-9223372036854775808ee"}));
+    for (std::size_t chunkSize = 1; chunkSize <= encoded.size(); ++chunkSize) {
+      REQUIRE(pushParse(encoded, chunkSize) == encoded);
+    }
+  }
+  SECTION("Torrent files fed in small chunks.", "[Bencode][Parse][Push]") {
+    auto [fileName] =
+        GENERATE(table<std::string>({kSingleFileTorrent, kMultiFileTorrent}));
+    const std::string encoded{
+        readBencodedBytesFromFile(prefixTestDataPath(fileName))};
+    REQUIRE(pushParse(encoded, 7) == encoded);
+    REQUIRE(pushParse(encoded, 4096) == encoded);
+  }
+  SECTION("Bytes after a completed value are left for the next one.",
+          "[Bencode][Parse][Push]") {
+    Push_Parser parser;
+    std::string_view stream{"i1el1:ae4:ab"};
+    parser.feed(stream);
+    REQUIRE(parser.complete());
+    REQUIRE(parser.consumed() == 3);
+    REQUIRE(NRef<Integer>(parser.take()).value() == 1);
+    stream.remove_prefix(parser.consumed());
+    parser.feed(stream);
+    REQUIRE(parser.consumed() == 5);
+    REQUIRE(NRef<List>(parser.take()).size() == 1);
+    stream.remove_prefix(parser.consumed());
+    parser.feed(stream);
+    REQUIRE_FALSE(parser.complete());
+    parser.feed("cd");
+    REQUIRE(NRef<String>(parser.take()).value() == "abcd");
+  }
+  SECTION("Taking a value before it is complete throws.",
+          "[Bencode][Parse][Push]") {
+    Push_Parser parser;
+    parser.feed("li1e");
+    REQUIRE_THROWS_WITH(parser.take(),
+                        "Push_Parser Error: No complete value to take.");
+  }
+  SECTION("Malformed input reports the same errors as the default parser.",
+          "[Bencode][Parse][Push]") {
+    auto [encoded] = GENERATE(table<std::string>(
+        {"x", "d1:bi1e1:ai2ee", "d1:ai1e1:ai2ee", "i12x", "-5:hello",
+         "5hello", "i01e", "i-0e", "d1:aee", "l3:abex", "di1ei2ee",
+         "i123456789012345678901e"}));
+    std::string expected;
+    std::string actual;
+    try {
+      const Bencode bencode;
+      bencode.parse(BufferSource{encoded});
+    } catch (const std::exception &ex) {
+      expected = ex.what();
+    }
+    Push_Parser parser;
+    try {
+      for (const char current : encoded) {
+        parser.feed(std::string_view{&current, 1});
+      }
+    } catch (const std::exception &ex) {
+      actual = ex.what();
+    }
+    REQUIRE(actual == expected);
+    // The parser is reset after an error
+    parser.feed("i5e");
+    REQUIRE(NRef<Integer>(parser.take()).value() == 5);
+    REQUIRE_THROWS_AS(parser.feed("i9223372036854775808e"), std::out_of_range);
+  }
+  SECTION("Nesting is limited by the default parser depth.",
+          "[Bencode][Parse][Push]") {
+    Push_Parser parser;
+    REQUIRE_THROWS_WITH(
+        parser.feed(std::string(Default_Parser::getMaxParserDepth(), 'l')),
+        "Bencode Syntax Error: Maximum parser depth exceeded.");
+  }
+}
@@ -64,6 +64,32 @@ TEST_CASE("Bencode for parse of simple types (integer, string) ",
     BufferSource source{"i-9223372036854775809e"};
     REQUIRE_THROWS_AS(bStringify.parse(source), std::out_of_range);
   }
+  SECTION("Parse integers either side of eight digit chunk boundaries.",
+          "[Bencode][Parse][Integer]") {
+    for (const Bencode::IntegerType expected :
+         {9999999LL, 12345678LL, 123456789LL, -87654321LL, 1234567890123456LL,
+          -12345678901234567LL, 1000000000000000000LL}) {
+      std::string encoded{"i"};
+      encoded += std::to_string(expected);
+      encoded += 'e';
+      bStringify.parse(BufferSource{encoded});
+      REQUIRE(NRef<Integer>(bStringify.root()).value() == expected);
+    }
+  }
+  SECTION("Parse twenty digit integer is out of range.",
+          "[Bencode][Parse][Integer]") {
+    REQUIRE_THROWS_AS(bStringify.parse(BufferSource{"i12345678901234567890e"}),
+                      std::out_of_range);
+  }
+  SECTION("Parse string with multi-digit length prefix.",
+          "[Bencode][Parse][String]") {
+    const std::string text(4321, 'x');
+    std::string encoded{std::to_string(text.size())};
+    encoded += ':';
+    encoded.append(text);
+    bStringify.parse(BufferSource{encoded});
+    REQUIRE(NRef<String>(bStringify.root()).value() == text);
+  }
   SECTION("Parse an string", "[Bencode][Parse][String]") {
     BufferSource source{"12:qwertyuiopas"};
     bStringify.parse(source);
@@ -0,0 +1,110 @@
+#include "Bencode_Lib_Tests.hpp"
+#include "YAML_Stringify.hpp"
+#include "Transcoder.hpp"
+
+// Output of the tree based stringifier for the same input
+template <typename Stringify, typename... Args>
+static std::string stringifyTree(const std::string &encoded, Args &&...args) {
+  const Bencode bStringify(
+      makeStringify<Stringify>(std::forward<Args>(args)...));
+  BufferDestination destination;
+  bStringify.parse(BufferSource{encoded});
+  bStringify.stringify(destination);
+  return destination.toString();
+}
+
+static std::string transcode(const std::string &encoded,
+                             const TranscodeFormat format,
+                             const BinaryEncoding binary =
+                                 BinaryEncoding::Escape) {
+  Transcoder transcoder{format, binary};
+  BufferDestination destination;
+  transcoder.transcode(BufferSource{encoded}, destination);
+  return destination.toString();
+}
+
+TEST_CASE("Transcode Bencode to JSON, XML and YAML.",
+          "[Bencode][Parse][Transcode]") {
+  SECTION("Scalars and containers match the stringifiers.",
+          "[Bencode][Parse][Transcode]") {
+    auto [encoded] = GENERATE(table<std::string>(
+        {"i-266e", "12:qwertyuiopas", "0:", "le", "de", "li1ei2ee", "li7ee",
+         "d3:onei1e5:threel1:ali2ei3eee3:twod1:xdeee",
+         "d4:listl2:ab2:cdledee1:xi0ee", "ll1:a1:bel1:c1:dee", "d1:ald1:bi1eeee"}));
+    REQUIRE(transcode(encoded, TranscodeFormat::JSON) ==
+            stringifyTree<JSON_Stringify>(encoded));
+    REQUIRE(transcode(encoded, TranscodeFormat::XML) ==
+            stringifyTree<XML_Stringify>(encoded));
+    REQUIRE(transcode(encoded, TranscodeFormat::YAML) ==
+            stringifyTree<YAML_Stringify>(encoded));
+  }
+  SECTION("Torrent files match the stringifiers.",
+          "[Bencode][Parse][Transcode]") {
+    auto [fileName] =
+        GENERATE(table<std::string>({kSingleFileTorrent, kMultiFileTorrent}));
+    const std::string encoded{
+        readBencodedBytesFromFile(prefixTestDataPath(fileName))};
+    REQUIRE(transcode(encoded, TranscodeFormat::JSON) ==
+            stringifyTree<JSON_Stringify>(encoded));
+    REQUIRE(transcode(encoded, TranscodeFormat::XML) ==
+            stringifyTree<XML_Stringify>(encoded));
+    REQUIRE(transcode(encoded, TranscodeFormat::YAML) ==
+            stringifyTree<YAML_Stringify>(encoded));
+    REQUIRE(transcode(encoded, TranscodeFormat::JSON, BinaryEncoding::Base64) ==
+            stringifyTree<JSON_Stringify>(encoded, BinaryEncoding::Base64));
+    REQUIRE(transcode(encoded, TranscodeFormat::XML, BinaryEncoding::Base64) ==
+            stringifyTree<XML_Stringify>(encoded, BinaryEncoding::Base64));
+    REQUIRE(transcode(encoded, TranscodeFormat::YAML, BinaryEncoding::Hex) ==
+            stringifyTree<YAML_Stringify>(encoded, BinaryEncoding::Hex));
+    Transcoder transcoder{TranscodeFormat::JSON};
+    BufferDestination destination;
+    transcoder.transcode(FileSource{prefixTestDataPath(fileName), 16},
+                         destination);
+    REQUIRE(destination.toString() == transcode(encoded, TranscodeFormat::JSON));
+  }
+  SECTION("Binary strings are written encoded.",
+          "[Bencode][Parse][Transcode]") {
+    const char bytes[] = "d4:name1:a6:pieces12:\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c" "e";
+    const std::string encoded(bytes, sizeof(bytes) - 1);
+    REQUIRE(transcode(encoded, TranscodeFormat::JSON, BinaryEncoding::Base64) ==
+            R"({"name" : "a","pieces" : {"base64" : "AQIDBAUGBwgJCgsM"}})");
+    REQUIRE(transcode(encoded, TranscodeFormat::XML, BinaryEncoding::Hex) ==
+            stringifyTree<XML_Stringify>(encoded, BinaryEncoding::Hex));
+    REQUIRE(transcode(encoded, TranscodeFormat::YAML, BinaryEncoding::Base64) ==
+            "---\n\"name\": \"a\"\n\"pieces\": !!binary \"AQIDBAUGBwgJCgsM\"\n...\n");
+  }
+  SECTION("XML lists of one element keep the element.",
+          "[Bencode][Parse][Transcode]") {
+    REQUIRE(transcode("d1:al1:bee", TranscodeFormat::XML) ==
+            R"(<?xml version="1.0" encoding="UTF-8"?><root><a><Row>b</Row></a></root>)");
+    REQUIRE(transcode("li7ee", TranscodeFormat::XML) ==
+            stringifyTree<XML_Stringify>("li7ee"));
+  }
+  SECTION("Malformed input reports the parser errors.",
+          "[Bencode][Parse][Transcode]") {
+    Transcoder transcoder{TranscodeFormat::YAML};
+    BufferDestination destination;
+    REQUIRE_THROWS_WITH(
+        transcoder.transcode(BufferSource{"d1:bi1e1:ai2ee"}, destination),
+        "Bencode Syntax Error: Dictionary keys not in sequence.");
+    const auto maxDepth = Default_Parser::getMaxParserDepth();
+    REQUIRE_THROWS_WITH(
+        transcoder.transcode(
+            BufferSource{std::string(maxDepth, 'l') + std::string(maxDepth, 'e')},
+            destination),
+        "Bencode Syntax Error: Maximum parser depth exceeded.");
+  }
+  SECTION("Data after the value is rejected without writing the trailer.",
+          "[Bencode][Parse][Transcode]") {
+    auto [format] = GENERATE(table<TranscodeFormat>(
+        {TranscodeFormat::JSON, TranscodeFormat::XML, TranscodeFormat::YAML}));
+    Transcoder transcoder{format};
+    BufferDestination destination;
+    REQUIRE_THROWS_WITH(
+        transcoder.transcode(BufferSource{"li1eei2e"}, destination),
+        "Bencode Syntax Error: Source stream terminated early.");
+    const std::string written{destination.toString()};
+    REQUIRE(written.find("</root>") == std::string::npos);
+    REQUIRE(written.find("...") == std::string::npos);
+  }
+}
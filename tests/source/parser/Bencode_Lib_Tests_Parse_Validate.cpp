@@ -0,0 +1,110 @@
+#include "Bencode_Lib_Tests.hpp"
+
+static ParseStatus validate(const std::string &encoded) {
+  return Bencode::validate(BufferSource{std::string_view(encoded)});
+}
+
+TEST_CASE("Validate Bencode without building a tree.",
+          "[Bencode][Parse][Validate]") {
+  SECTION("Well formed documents validate.", "[Bencode][Parse][Validate]") {
+    REQUIRE(validate("i266e").ok());
+    REQUIRE(validate("i-12e").ok());
+    REQUIRE(validate("0:").ok());
+    REQUIRE(validate("5:hello").ok());
+    REQUIRE(validate("le").ok());
+    REQUIRE(validate("de").ok());
+    REQUIRE(validate("d1:ali1ei2ee1:bd1:c3:xyzee").ok());
+    REQUIRE(Bencode::validate(
+                MmapFileSource{prefixTestDataPath(kMultiFileTorrent)})
+                .ok());
+    REQUIRE(Bencode::validate(
+                FileSource{prefixTestDataPath(kSingleFileTorrent), 64})
+                .ok());
+    REQUIRE(Bencode::validate(
+                BufferSource{readBencodedBytesFromFile(
+                    prefixTestDataPath(kMultiFileTorrent))})
+                .ok());
+  }
+  SECTION("Integer errors report their code and offset.",
+          "[Bencode][Parse][Validate]") {
+    ParseStatus status = validate("li1ei01ee");
+    REQUIRE(status.code == ErrorCode::LeadingZero);
+    REQUIRE(status.offset == 4);
+    status = validate("ie");
+    REQUIRE(status.code == ErrorCode::InvalidInteger);
+    REQUIRE(status.offset == 0);
+    status = validate("i-0e");
+    REQUIRE(status.code == ErrorCode::NegativeZero);
+    REQUIRE(status.message == "Negative zero is not allowed.");
+    status = validate("i99999999999999999999e");
+    REQUIRE(status.code == ErrorCode::IntegerOverflow);
+    status = validate("i12x");
+    REQUIRE(status.code == ErrorCode::MissingEndTerminator);
+    REQUIRE(status.offset == 3);
+  }
+  SECTION("String errors report their code and offset.",
+          "[Bencode][Parse][Validate]") {
+    ParseStatus status = validate("l-3:abce");
+    REQUIRE(status.code == ErrorCode::NegativeStringLength);
+    REQUIRE(status.offset == 1);
+    status = validate("l3abce");
+    REQUIRE(status.code == ErrorCode::MissingColon);
+    REQUIRE(status.offset == 2);
+    status = validate("l10:abce");
+    REQUIRE(status.code == ErrorCode::UnexpectedEndOfSource);
+    REQUIRE(status.offset == 8);
+    status = validate("l03:abce");
+    REQUIRE(status.code == ErrorCode::LeadingZero);
+  }
+  SECTION("Dictionary key errors report their code and offset.",
+          "[Bencode][Parse][Validate]") {
+    ParseStatus status = validate("d1:bi1e1:ai2ee");
+    REQUIRE(status.code == ErrorCode::DictionaryKeyOrder);
+    REQUIRE(status.offset == 7);
+    REQUIRE(status.message == "Dictionary keys not in sequence.");
+    status = validate("d1:ai1e1:ai2ee");
+    REQUIRE(status.code == ErrorCode::DuplicateDictionaryKey);
+    REQUIRE(status.offset == 7);
+    status = validate("di1ei2ee");
+    REQUIRE(status.code == ErrorCode::UnexpectedToken);
+    REQUIRE(status.offset == 1);
+  }
+  SECTION("Key order is checked on block read file sources.",
+          "[Bencode][Parse][Validate]") {
+    const std::string fileName{generateRandomFileName()};
+    Bencode::toFile(fileName, "d20:aaaaaaaaaaaaaaaaaaaai1e20:aaaaaaaaaaaaaaaaaaaai2ee");
+    const ParseStatus status = Bencode::validate(FileSource{fileName, 8});
+    REQUIRE(status.code == ErrorCode::DuplicateDictionaryKey);
+    REQUIRE(status.offset == 27);
+    std::filesystem::remove(fileName);
+  }
+  SECTION("Structure errors report their code and offset.",
+          "[Bencode][Parse][Validate]") {
+    ParseStatus status = validate("li1ei2e");
+    REQUIRE(status.code == ErrorCode::UnexpectedEndOfSource);
+    REQUIRE(status.offset == 7);
+    status = validate("li1ee5:extra");
+    REQUIRE(status.code == ErrorCode::SourceTerminatedEarly);
+    REQUIRE(status.offset == 5);
+    status = validate("lxe");
+    REQUIRE(status.code == ErrorCode::UnexpectedToken);
+    REQUIRE(status.offset == 1);
+    status = validate("llllllllllllllllllllee");
+    REQUIRE(status.code == ErrorCode::MaximumParserDepthExceeded);
+    REQUIRE(status.offset == Default_Parser::getMaxParserDepth() - 1);
+  }
+  SECTION("Results agree with Default_Parser.", "[Bencode][Parse][Validate]") {
+    for (const std::string encoded :
+         {"d1:ai1ee", "d1:bi1e1:ai2ee", "i01e", "li1e", "3:ab", "le", "x",
+          "d3:keyl4:spamee", "i-0e", "l-1:ae"}) {
+      bool parsed = true;
+      try {
+        Bencode bencode;
+        bencode.parse(BufferSource{std::string_view(encoded)});
+      } catch (const std::exception &) {
+        parsed = false;
+      }
+      REQUIRE(validate(encoded).ok() == parsed);
+    }
+  }
+}
@@ -207,4 +207,134 @@ TEST_CASE("JSON stringify of collection types (list, dictionary) ",
     bStringify.stringify(destination);
     REQUIRE(destination.toString() == "-1");
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE("JSON string escaping written straight to the destination.",
+          "[Bencode][Stringify][JSON][Translator]") {
+  const Default_Translator translator;
+  SECTION("Every byte at every position of a word is escaped correctly.",
+          "[Bencode][Stringify][JSON][Translator]") {
+    for (int byte = 0; byte < 256; ++byte) {
+      const char ch = static_cast<char>(byte);
+      std::string escape{ch};
+      if (byte < 0x20 || byte > 0x7e) {
+        const auto digits = "0123456789ABCDEF";
+        escape = std::string{"\\u00"} + digits[byte >> 4] + digits[byte & 0xf];
+      }
+      for (std::size_t position = 0; position < 19; ++position) {
+        std::string raw(19, 'a');
+        raw[position] = ch;
+        BufferDestination destination;
+        translator.to(raw, destination);
+        REQUIRE(destination.toString() == std::string(position, 'a') + escape +
+                                              std::string(18 - position, 'a'));
+        REQUIRE(translator.to(raw) == destination.toString());
+      }
+    }
+  }
+  SECTION("Long plain runs are added to the destination whole.",
+          "[Bencode][Stringify][JSON][Translator]") {
+    const std::string plain(1000, 'x');
+    const std::string raw = plain + '\n' + plain;
+    std::string translated;
+    ContainerDestination<std::string> destination{translated};
+    translator.to(raw, destination);
+    REQUIRE(translated == plain + "\\u000A" + plain);
+  }
+}
+TEST_CASE("JSON stringify of binary strings.",
+          "[Bencode][Stringify][JSON][Binary]") {
+  SECTION("Base64 and hex encode known vectors.",
+          "[Bencode][Stringify][JSON][Binary]") {
+    const auto encode = [](const std::string_view bytes,
+                           const BinaryEncoding encoding) {
+      BufferDestination destination;
+      addBinary(bytes, encoding, destination);
+      return destination.toString();
+    };
+    REQUIRE(encode("", BinaryEncoding::Base64).empty());
+    REQUIRE(encode("f", BinaryEncoding::Base64) == "Zg==");
+    REQUIRE(encode("fo", BinaryEncoding::Base64) == "Zm8=");
+    REQUIRE(encode("foo", BinaryEncoding::Base64) == "Zm9v");
+    REQUIRE(encode("foobar", BinaryEncoding::Base64) == "Zm9vYmFy");
+    REQUIRE(encode(std::string_view("\x00\xff\x10", 3), BinaryEncoding::Hex) ==
+            "00ff10");
+    const std::string large(3000, '\xfb');
+    REQUIRE(encode(large, BinaryEncoding::Base64) ==
+            [] {
+              std::string expected;
+              for (int group = 0; group < 1000; ++group) {
+                expected += "+/v7";
+              }
+              return expected;
+            }());
+  }
+  SECTION("Unprintable bytes are counted exactly.",
+          "[Bencode][Stringify][JSON][Binary]") {
+    for (int byte = 0; byte < 256; ++byte) {
+      std::string text(17, 'a');
+      text[byte % 17] = static_cast<char>(byte);
+      REQUIRE(unprintableCount(text) == (byte < 0x20 || byte > 0x7e ? 1 : 0));
+    }
+  }
+  SECTION("Binary strings are encoded and text strings escaped.",
+          "[Bencode][Stringify][JSON][Binary]") {
+    const Bencode bStringify(
+        makeStringify<JSON_Stringify>(BinaryEncoding::Base64));
+    BufferDestination destination;
+    const char encoded[] = "d4:name2:a\n6:pieces12:\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c" "e";
+    bStringify.parse(BufferSource{std::string_view(encoded, sizeof(encoded) - 1)});
+    bStringify.stringify(destination);
+    REQUIRE(destination.toString() ==
+            R"({"name" : "a\u000A","pieces" : {"base64" : "AQIDBAUGBwgJCgsM"}})");
+    const Bencode bHex(makeStringify<JSON_Stringify>(BinaryEncoding::Hex));
+    destination.clear();
+    bHex.parse(BufferSource{std::string_view("12:\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c", 15)});
+    bHex.stringify(destination);
+    REQUIRE(destination.toString() == R"({"hex" : "0102030405060708090a0b0c"})");
+  }
+  SECTION("Torrent pieces shrink the JSON export.",
+          "[Bencode][Stringify][JSON][Binary]") {
+    const Bencode escaped(makeStringify<JSON_Stringify>());
+    escaped.parse(FileSource{prefixTestDataPath(kMultiFileTorrent)});
+    BufferDestination escapedDestination;
+    escaped.stringify(escapedDestination);
+    const Bencode encoded(makeStringify<JSON_Stringify>(BinaryEncoding::Base64));
+    encoded.parse(FileSource{prefixTestDataPath(kMultiFileTorrent)});
+    BufferDestination encodedDestination;
+    encoded.stringify(encodedDestination);
+    REQUIRE(encodedDestination.toString().find(R"("pieces" : {"base64" : ")") !=
+            std::string::npos);
+    REQUIRE(encodedDestination.size() * 2 < escapedDestination.size());
+  }
+  SECTION("Stringifiers with different encodings do not share one.",
+          "[Bencode][Stringify][JSON][Binary]") {
+    const JSON_Stringify base64{BinaryEncoding::Base64};
+    const JSON_Stringify escape{};
+    const Bencode bencode;
+    bencode.parse(BufferSource{std::string_view(
+        "12:\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c", 15)});
+    BufferDestination destination;
+    base64.stringify(bencode.root(), destination);
+    REQUIRE(destination.toString() == R"({"base64" : "AQIDBAUGBwgJCgsM"})");
+  }
+  SECTION("Encoded blocks written to a GatherDestination are copied.",
+          "[Bencode][Stringify][JSON][Binary]") {
+    std::string encoded{"l600:"};
+    encoded.append(600, '\x01');
+    encoded += "600:";
+    encoded.append(600, '\x02');
+    encoded += 'e';
+    const Bencode bencode;
+    bencode.parse(BufferSource{encoded});
+    const JSON_Stringify stringify{BinaryEncoding::Base64};
+    BufferDestination expected;
+    stringify.stringify(bencode.root(), expected);
+    const std::string fileName{generateRandomFileName()};
+    GatherDestination destination{fileName, 1};
+    stringify.stringify(bencode.root(), destination);
+    destination.close();
+    REQUIRE(readBencodedBytesFromFile(fileName) == expected.toString());
+    std::filesystem::remove(fileName);
+  }
+}
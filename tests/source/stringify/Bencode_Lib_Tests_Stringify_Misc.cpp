@@ -115,4 +115,88 @@ TEST_CASE("Stringify to file round-trips correctly",
     std::filesystem::remove(fname);
     REQUIRE(dest.toString() == "d3:agei25e4:name5:Alicee");
   }
-}
\ No newline at end of file
+}
+TEST_CASE("Stringify with exact size pre-computation",
+          "[Bencode][Stringify][EncodedSize]") {
+  SECTION("Encoded size matches the stringified length.",
+          "[Bencode][Stringify][EncodedSize]") {
+    for (const std::string encoded :
+         {"i0e", "i-9223372036854775808e", "i9223372036854775807e", "0:",
+          "10:0123456789", "le", "de", "d1:ali1ei-22ee1:b0:1:cd1:dleee"}) {
+      Bencode bencode;
+      bencode.parse(BufferSource{std::string_view(encoded)});
+      REQUIRE(encodedSize(bencode.root()) == encoded.size());
+    }
+  }
+  SECTION("Stringify into a caller supplied string and vector.",
+          "[Bencode][Stringify][EncodedSize]") {
+    Bencode bencode;
+    bencode.parse(FileSource{prefixTestDataPath(kMultiFileTorrent)});
+    const std::string expected{
+        readBencodedBytesFromFile(prefixTestDataPath(kMultiFileTorrent))};
+    const Default_Stringify stringify;
+    std::string encoded;
+    stringify.stringify(bencode.root(), encoded);
+    REQUIRE(encoded == expected);
+    REQUIRE(encoded.capacity() - expected.size() < 32);
+    std::vector<char> bytes{'x'};
+    stringify.stringify(bencode.root(), bytes);
+    REQUIRE(bytes.size() == expected.size() + 1);
+    REQUIRE(std::string_view(bytes.data() + 1, bytes.size() - 1) == expected);
+  }
+  SECTION("Verbatim containers are counted at their original size.",
+          "[Bencode][Stringify][EncodedSize]") {
+    const std::string original{"d1:ald1:bi1eee1:c5:helloe"};
+    Bencode bencode{nullptr, makeParser<Default_Parser>(
+                                 ParseOptions{.sourceRanges = true})};
+    bencode.parse(BufferSource{std::string_view(original)});
+    const Default_Stringify stringify{original};
+    REQUIRE(stringify.encodedSize(bencode.root()) == original.size());
+    NRef<String>(bencode["c"]).assign("hi");
+    REQUIRE(stringify.encodedSize(bencode.root()) == original.size() - 3);
+    std::string encoded;
+    stringify.stringify(bencode.root(), encoded);
+    REQUIRE(encoded == "d1:ald1:bi1eee1:c2:hie");
+  }
+}
+
+TEST_CASE("Format integers without allocation",
+          "[Bencode][Stringify][IntegerFormat]") {
+  SECTION("Digits match std::to_string across magnitudes.",
+          "[Bencode][Stringify][IntegerFormat]") {
+    for (long long value = 1; value > 0 && value < 1000000000000000000ll;
+         value *= 7) {
+      for (const long long check : {value - 1, value, value + 1, -value}) {
+        REQUIRE(IntegerFormat{check}.view() == std::to_string(check));
+        REQUIRE(IntegerFormat::digitCount(
+                    static_cast<unsigned long long>(check < 0 ? -check
+                                                              : check)) ==
+                std::to_string(check < 0 ? -check : check).size());
+      }
+    }
+  }
+  SECTION("Limits of the integer types.",
+          "[Bencode][Stringify][IntegerFormat]") {
+    REQUIRE(IntegerFormat{0}.view() == "0");
+    REQUIRE(IntegerFormat{9}.view() == "9");
+    REQUIRE(IntegerFormat{10}.view() == "10");
+    REQUIRE(IntegerFormat{99}.view() == "99");
+    REQUIRE(IntegerFormat{100}.view() == "100");
+    REQUIRE(IntegerFormat{std::numeric_limits<int64_t>::min()}.view() ==
+            "-9223372036854775808");
+    REQUIRE(IntegerFormat{std::numeric_limits<int64_t>::max()}.view() ==
+            "9223372036854775807");
+    REQUIRE(IntegerFormat{std::numeric_limits<unsigned long long>::max()}
+                .view() == "18446744073709551615");
+    REQUIRE(IntegerFormat::digitCount(
+                std::numeric_limits<unsigned long long>::max()) == 20);
+  }
+  SECTION("Integers at the limits round-trip.",
+          "[Bencode][Stringify][IntegerFormat]") {
+    Bencode bencode;
+    bencode.parse(BufferSource{"li-9223372036854775808ei0ei1234567ee"});
+    BufferDestination destination;
+    bencode.stringify(destination);
+    REQUIRE(destination.toString() == "li-9223372036854775808ei0ei1234567ee");
+  }
+}
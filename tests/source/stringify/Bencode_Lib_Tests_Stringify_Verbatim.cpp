@@ -0,0 +1,81 @@
+#include "Bencode_Lib_Tests.hpp"
+
+static std::string stringifyFrom(const std::string_view original,
+                                 const Node &bNode) {
+  BufferDestination destination;
+  Default_Stringify{original}.stringify(bNode, destination);
+  return destination.toString();
+}
+
+TEST_CASE("Stringify unmodified containers from their source bytes.",
+          "[Bencode][Stringify][Verbatim]") {
+  const std::string encoded{"d1:ali1ei2ee1:bd1:ci3eee"};
+  const ParseOptions options{.sourceRanges = true};
+  SECTION("Parsing records the source bytes of each container.",
+          "[Bencode][Stringify][Verbatim]") {
+    const Bencode bencode{nullptr, makeParser<Default_Parser>(options)};
+    bencode.parse(BufferSource{encoded});
+    const auto &root = NRef<Dictionary>(bencode.root());
+    REQUIRE(root.sourceRange().begin == 0);
+    REQUIRE(root.sourceRange().end == encoded.size());
+    REQUIRE(NRef<List>(bencode["a"]).sourceRange().begin == 4);
+    REQUIRE(NRef<List>(bencode["a"]).sourceRange().end == 12);
+    REQUIRE(NRef<Dictionary>(bencode["b"]).sourceRange().begin == 15);
+    REQUIRE(NRef<Dictionary>(bencode["b"]).sourceRange().end == 23);
+  }
+  SECTION("Source bytes are not recorded by default.",
+          "[Bencode][Stringify][Verbatim]") {
+    const Bencode bencode;
+    bencode.parse(BufferSource{encoded});
+    REQUIRE(NRef<Dictionary>(bencode.root()).sourceRange().empty());
+    REQUIRE(NRef<List>(bencode["a"]).sourceRange().empty());
+  }
+  SECTION("Unmodified containers are copied from the original.",
+          "[Bencode][Stringify][Verbatim]") {
+    std::string original{encoded};
+    const Bencode bencode{nullptr, makeParser<Default_Parser>(options)};
+    bencode.parse(BufferSource{std::string_view(original)});
+    // Only a copy picks up a change made to the original bytes
+    original[9] = '7';
+    REQUIRE(stringifyFrom(original, bencode.root()) ==
+            "d1:ali1ei7ee1:bd1:ci3eee");
+    REQUIRE(stringifyFrom({}, bencode.root()) == encoded);
+  }
+  SECTION("Modified containers and their parents are encoded.",
+          "[Bencode][Stringify][Verbatim]") {
+    std::string original{encoded};
+    Bencode bencode{nullptr, makeParser<Default_Parser>(options)};
+    bencode.parse(BufferSource{std::string_view(original)});
+    original[9] = '7';
+    original[20] = '8';
+    bencode["b"]["c"] = 5;
+    REQUIRE(NRef<Dictionary>(bencode.root()).sourceRange().empty());
+    REQUIRE(NRef<Dictionary>(bencode["b"]).sourceRange().empty());
+    REQUIRE(stringifyFrom(original, bencode.root()) ==
+            "d1:ali1ei7ee1:bd1:ci5eee");
+  }
+  SECTION("An original that does not match is not copied.",
+          "[Bencode][Stringify][Verbatim]") {
+    const Bencode bencode{nullptr, makeParser<Default_Parser>(options)};
+    bencode.parse(BufferSource{encoded});
+    REQUIRE(stringifyFrom("x1:ali1ei2ee1:bd1:ci3eex", bencode.root()) ==
+            encoded);
+    REQUIRE(stringifyFrom("d1:a", bencode.root()) == encoded);
+  }
+  SECTION("Torrent files read in blocks record file offsets.",
+          "[Bencode][Stringify][Verbatim]") {
+    auto [fileName] =
+        GENERATE(table<std::string>({kSingleFileTorrent, kMultiFileTorrent}));
+    const std::string torrent{
+        readBencodedBytesFromFile(prefixTestDataPath(fileName))};
+    Bencode bencode{nullptr, makeParser<Default_Parser>(options)};
+    bencode.parse(FileSource{prefixTestDataPath(fileName), 64});
+    REQUIRE(NRef<Dictionary>(bencode.root()).sourceRange().end ==
+            torrent.size());
+    bencode["announce"] = "http://tracker.example.com/announce";
+    REQUIRE_FALSE(NRef<Dictionary>(bencode["info"]).sourceRange().empty());
+    BufferDestination expected;
+    bencode.stringify(expected);
+    REQUIRE(stringifyFrom(torrent, bencode.root()) == expected.toString());
+  }
+}
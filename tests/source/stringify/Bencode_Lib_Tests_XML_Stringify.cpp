@@ -121,6 +121,16 @@ TEST_CASE("XML stringify of collection types (list, dictionary) ",
         destination.toString() ==
         R"(<?xml version="1.0" encoding="UTF-8"?><root><Row></Row></root>)");
   }
+  SECTION("XML stringify a List of one element.",
+          "[Bencode][Stringify][XML][List]") {
+    BufferSource source{"li7ee"};
+    BufferDestination destination;
+    bStringify.parse(source);
+    bStringify.stringify(destination);
+    REQUIRE(
+        destination.toString() ==
+        R"(<?xml version="1.0" encoding="UTF-8"?><root><Row>7</Row></root>)");
+  }
   SECTION("XML stringify an Dictionary of integers.",
           "[Bencode][Stringify][XML][Dictionary]") {
     BufferSource source{"d3:onei1e5:threei3e3:twoi2ee"};
@@ -267,4 +277,82 @@ TEST_CASE("XML stringify of collection types (list, dictionary) ",
         destination.toString() ==
         R"(<?xml version="1.0" encoding="UTF-8"?><root>&lt;tag&gt;</root>)");
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE("XML element names from dictionary keys.",
+          "[Bencode][Stringify][XML][Dictionary]") {
+  const Bencode bStringify(makeStringify<XML_Stringify>());
+  SECTION("Spaces in keys become '-' in element names.",
+          "[Bencode][Stringify][XML][Dictionary]") {
+    BufferDestination destination;
+    bStringify.parse(BufferSource{"d3: a i1e1:bi1e7:x  y z i2ee"});
+    bStringify.stringify(destination);
+    REQUIRE(
+        destination.toString() ==
+        R"(<?xml version="1.0" encoding="UTF-8"?><root><-a->1</-a-><b>1</b><x--y-z->2</x--y-z-></root>)");
+  }
+}
+TEST_CASE("XML string escaping written straight to the destination.",
+          "[Bencode][Stringify][XML][Translator]") {
+  const XML_Translator translator;
+  SECTION("Every byte at every position of a word is escaped correctly.",
+          "[Bencode][Stringify][XML][Translator]") {
+    for (int byte = 0; byte < 256; ++byte) {
+      const char ch = static_cast<char>(byte);
+      std::string escape{ch};
+      if (byte < 0x20 || byte > 0x7e) {
+        const auto digits = "0123456789ABCDEF";
+        escape = std::string{"&#x00"} + digits[byte >> 4] + digits[byte & 0xf] +
+                 ";";
+      } else if (ch == '&') {
+        escape = "&amp;";
+      } else if (ch == '<') {
+        escape = "&lt;";
+      } else if (ch == '>') {
+        escape = "&gt;";
+      } else if (ch == '\'') {
+        escape = "&apos;";
+      } else if (ch == '"') {
+        escape = "&quot;";
+      }
+      for (std::size_t position = 0; position < 19; ++position) {
+        std::string raw(19, 'a');
+        raw[position] = ch;
+        BufferDestination destination;
+        translator.to(raw, destination);
+        REQUIRE(destination.toString() == std::string(position, 'a') + escape +
+                                              std::string(18 - position, 'a'));
+        REQUIRE(translator.to(raw) == destination.toString());
+      }
+    }
+  }
+}
+TEST_CASE("XML stringify of binary strings.",
+          "[Bencode][Stringify][XML][Binary]") {
+  SECTION("Binary strings are encoded and text strings escaped.",
+          "[Bencode][Stringify][XML][Binary]") {
+    const Bencode bStringify(makeStringify<XML_Stringify>(BinaryEncoding::Hex));
+    BufferDestination destination;
+    const char encoded[] = "d4:name2:a&6:pieces12:\x01\x02\xff\x01\x02\xff\x01\x02\xff\x01\x02\xff" "e";
+    bStringify.parse(BufferSource{std::string_view(encoded, sizeof(encoded) - 1)});
+    bStringify.stringify(destination);
+    REQUIRE(
+        destination.toString() ==
+        R"(<?xml version="1.0" encoding="UTF-8"?><root><name>a&amp;</name><pieces><Hex>0102ff0102ff0102ff0102ff</Hex></pieces></root>)");
+  }
+  SECTION("XML escapes are longer so short strings encode sooner.",
+          "[Bencode][Stringify][XML][Binary]") {
+    const Bencode bencode;
+    bencode.parse(BufferSource{std::string_view("3:\x01\x02\x03", 5)});
+    BufferDestination destination;
+    XML_Stringify{BinaryEncoding::Base64}.stringify(bencode.root(),
+                                                    destination);
+    REQUIRE(
+        destination.toString() ==
+        R"(<?xml version="1.0" encoding="UTF-8"?><root><Base64>AQID</Base64></root>)");
+    destination.clear();
+    JSON_Stringify{BinaryEncoding::Base64}.stringify(bencode.root(),
+                                                     destination);
+    REQUIRE(destination.toString() == R"("\u0001\u0002\u0003")");
+  }
+}
@@ -221,4 +221,38 @@ TEST_CASE("YAML stringify of collection types (list, dictionary) ",
     bStringify.stringify(destination);
     REQUIRE(destination.toString() == "---\n\"nums\": \n  - 1\n  - 2\n...\n");
   }
+  SECTION("YAML stringify dictionaries nested deeper than the indent table.",
+          "[Bencode][Stringify][YAML][Dictionary]") {
+    Default_Parser::setMaxParserDepth(30);
+    std::string encoded;
+    std::string expected{"---\n"};
+    for (std::size_t depth = 0; depth < 20; ++depth) {
+      encoded += "d1:a";
+      expected.append(depth * 2, ' ');
+      expected += "\"a\": ";
+      expected += depth < 19 ? "\n" : "1\n";
+    }
+    encoded += "i1e";
+    encoded.append(20, 'e');
+    expected += "...\n";
+    BufferDestination destination;
+    bStringify.parse(BufferSource{encoded});
+    bStringify.stringify(destination);
+    Default_Parser::setMaxParserDepth(10);
+    REQUIRE(destination.toString() == expected);
+  }
+}
+TEST_CASE("YAML stringify of binary strings.",
+          "[Bencode][Stringify][YAML][Binary]") {
+  SECTION("Binary strings are written with a binary tag.",
+          "[Bencode][Stringify][YAML][Binary]") {
+    const Bencode bStringify(
+        makeStringify<YAML_Stringify>(BinaryEncoding::Base64));
+    BufferDestination destination;
+    const char encoded[] = "d4:name1:a6:pieces12:\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c" "e";
+    bStringify.parse(BufferSource{std::string_view(encoded, sizeof(encoded) - 1)});
+    bStringify.stringify(destination);
+    REQUIRE(destination.toString() ==
+            "---\n\"name\": \"a\"\n\"pieces\": !!binary \"AQIDBAUGBwgJCgsM\"\n...\n");
+  }
 }
@@ -0,0 +1,109 @@
+#include "Bencode_Lib_Tests.hpp"
+
+TEST_CASE("BencodeTape flat document.", "[Bencode][Tape]") {
+  SECTION("Parse integer onto tape and read it back.", "[Bencode][Tape]") {
+    BencodeTape tape;
+    tape.parse(BufferSource{"i-266e"});
+    REQUIRE(isA<Integer>(tape.root()));
+    REQUIRE(tape.root().integer() == -266);
+    REQUIRE(tape.tapeSize() == 2);
+  }
+  SECTION("Parse string onto tape and read it back.", "[Bencode][Tape]") {
+    BencodeTape tape;
+    tape.parse(BufferSource{"12:qwertyuiopas"});
+    REQUIRE(isA<String>(tape.root()));
+    REQUIRE(tape.root().string() == "qwertyuiopas");
+    REQUIRE(tape.arenaSize() == 12);
+  }
+  SECTION("Navigate lists and dictionaries with cursors.", "[Bencode][Tape]") {
+    BencodeTape tape;
+    tape.parse(BufferSource{"d3:onei1e5:threel1:a1:be3:twod1:xi2eee"});
+    REQUIRE(isA<Dictionary>(tape.root()));
+    REQUIRE(tape.root().size() == 3);
+    REQUIRE(tape["one"].integer() == 1);
+    REQUIRE(isA<List>(tape["three"]));
+    REQUIRE(tape["three"].size() == 2);
+    REQUIRE(tape["three"][1].string() == "b");
+    REQUIRE(tape["two"]["x"].integer() == 2);
+    REQUIRE(tape.root().contains("two"));
+    REQUIRE_FALSE(tape.root().contains("four"));
+  }
+  SECTION("Iterate dictionary entries in key order.", "[Bencode][Tape]") {
+    BencodeTape tape;
+    tape.parse(BufferSource{"d1:ai1e1:bli2ei3ee1:c0:e"});
+    std::string keys;
+    for (auto entry = tape.root().begin(); entry != tape.root().end();
+         ++entry) {
+      keys += entry.key();
+    }
+    REQUIRE(keys == "abc");
+    Bencode::IntegerType total = 0;
+    for (const auto element : tape["b"]) {
+      total += element.integer();
+    }
+    REQUIRE(total == 5);
+  }
+  SECTION("Accessing a value as the wrong type throws.", "[Bencode][Tape]") {
+    BencodeTape tape;
+    tape.parse(BufferSource{"li1ee"});
+    REQUIRE_THROWS_WITH(tape.root().integer(),
+                        "BencodeTape Error: Tape value not an integer.");
+    REQUIRE_THROWS_WITH(tape["key"],
+                        "BencodeTape Error: Tape value not a dictionary.");
+    REQUIRE_THROWS_WITH(tape[1],
+                        "BencodeTape Error: Invalid index used in list.");
+    REQUIRE_THROWS_AS(BencodeTape{}.root(), BencodeTape::Error);
+  }
+  SECTION("Stringify torrent files identically to Default_Stringify.",
+          "[Bencode][Tape]") {
+    auto [fileName] =
+        GENERATE(table<std::string>({kSingleFileTorrent, kMultiFileTorrent}));
+    const std::string encoded{
+        readBencodedBytesFromFile(prefixTestDataPath(fileName))};
+    BencodeTape tape;
+    tape.parse(BufferSource{encoded});
+    BufferDestination destination;
+    tape.stringify(destination);
+    REQUIRE(destination.toString() == encoded);
+    const Bencode bencode;
+    bencode.parse(BufferSource{encoded});
+    REQUIRE(tape["info"]["name"].string() ==
+            NRef<String>(bencode["info"]["name"]).value());
+  }
+  SECTION("Flatten an existing Node tree onto a tape.", "[Bencode][Tape]") {
+    const Bencode bencode;
+    bencode.parse(BufferSource{"d4:infod6:lengthi1024e4:name8:file.txtee"});
+    const BencodeTape tape = BencodeTape::fromNode(bencode.root());
+    BufferDestination expected;
+    BufferDestination actual;
+    bencode.stringify(expected);
+    tape.stringify(actual);
+    REQUIRE(actual.toString() == expected.toString());
+    REQUIRE(tape["info"]["length"].integer() == 1024);
+  }
+  SECTION("Malformed input reports the same errors as the default parser.",
+          "[Bencode][Tape]") {
+    BencodeTape tape;
+    REQUIRE_THROWS_WITH(tape.parse(BufferSource{"d1:bi1e1:ai2ee"}),
+                        "Bencode Syntax Error: Dictionary keys not in sequence.");
+    REQUIRE_THROWS_AS(tape.parse(BufferSource{"i9223372036854775808e"}),
+                      std::out_of_range);
+    REQUIRE(tape.empty());
+    auto [encoded, message] = GENERATE(table<std::string, std::string>(
+        {{"d1:ae", "Bencode Syntax Error: Expected integer or string while "
+                   "parsing container."},
+         {"d1:ad1:bee", "Bencode Syntax Error: Expected integer or string "
+                        "while parsing container."},
+         {"i1ei2e", "Bencode Syntax Error: Source stream terminated early."}}));
+    REQUIRE_THROWS_WITH(tape.parse(BufferSource{encoded}), message);
+    REQUIRE(tape.empty());
+  }
+  SECTION("Parse from a block buffered FileSource.", "[Bencode][Tape]") {
+    BencodeTape tape;
+    tape.parse(FileSource{prefixTestDataPath(kSingleFileTorrent), 16});
+    BufferDestination destination;
+    tape.stringify(destination);
+    REQUIRE(destination.toString() ==
+            readBencodedBytesFromFile(prefixTestDataPath(kSingleFileTorrent)));
+  }
+}